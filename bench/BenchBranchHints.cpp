@@ -0,0 +1,63 @@
+// ============================================================================
+// Benchmark comparing the branch hint policies on failing pipelines.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BenchBranchHints.cpp: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Benchmark source
+#include "BenchHarness.h"
+#include "CountingNew.h"
+
+// ============================================================================
+// Benchmark fixtures section
+// ============================================================================
+
+// Defined by BranchHintsWorkload.cpp, built once per policy.
+void register_expect_success(BenchHarness& harness);
+void register_expect_failure(BenchHarness& harness);
+void register_no_hints(BenchHarness& harness);
+
+// ============================================================================
+// Main function section
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+  BenchHarness harness{argc, argv};
+
+  register_expect_success(harness);
+  register_expect_failure(harness);
+  register_no_hints(harness);
+
+  return harness.finish();
+}
+
+// End of 'BenchBranchHints.cpp'
@@ -0,0 +1,216 @@
+// ============================================================================
+// Benchmark comparing branchless and branchy pipelines on random failures.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BenchBranchless.cpp: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Benchmark source
+#include "AdaptiveEvaluation.h"
+#include "BenchHarness.h"
+#include "Branchless.h"
+#include "CountingNew.h"
+
+// Standard library headers
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Benchmark fixtures section
+// ============================================================================
+
+// Inputs of which 'failure_rate' fail, half of them at the first stage and
+// half at the third, in a random order too long for the branch predictor to
+// learn.
+template <typename T>
+static std::vector<T> make_inputs(double failure_rate) {
+  std::mt19937 random{42};
+  std::bernoulli_distribution fails{failure_rate};
+  std::bernoulli_distribution early{0.5};
+  std::uniform_int_distribution<int> values{0, 999};
+
+  std::vector<T> inputs(1u << 16);
+  for (auto& in : inputs) {
+    in = static_cast<T>(values(random));
+    if (fails(random)) {
+      in = early(random) ? -in - 1 : in + 1000000;
+    }
+  }
+
+  return inputs;
+}
+
+// Inputs alternating between runs of 1% and 50% failures, each long enough
+// for an adaptive pipeline to settle.
+static std::vector<int> make_phased_inputs() {
+  auto rare = make_inputs<int>(0.01);
+  auto frequent = make_inputs<int>(0.5);
+
+  std::vector<int> inputs(rare.size());
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    inputs[i] = 0 == (i >> 14) % 2 ? rare[i] : frequent[i];
+  }
+
+  return inputs;
+}
+
+template <typename T>
+static Maybe<T> nonNegativeM(T a) {
+  return 0 <= a ? Maybe<T>{a} : Maybe<T>{};
+}
+
+template <typename T>
+static Maybe<T> scaleM(T a) {
+  return a * 3;
+}
+
+template <typename T>
+static Maybe<T> boundedM(T a) {
+  return a < 3000000 ? Maybe<T>{a} : Maybe<T>{};
+}
+
+template <typename T>
+static Maybe<T> offsetM(T a) {
+  return a + 1;
+}
+
+// Failures copy prepared errors, so the allocation of a new message
+// doesn't swamp the cost of the branches.
+static Err const negative{"Negative"};
+static Err const too_large{"Too large"};
+
+static Either<int> nonNegativeE(int a) {
+  if (0 > a) {
+    return negative;
+  }
+
+  return a;
+}
+
+static Either<int> scaleE(int a) {
+  return a * 3;
+}
+
+static Either<int> boundedE(int a) {
+  if (3000000 <= a) {
+    return too_large;
+  }
+
+  return a;
+}
+
+static Either<int> offsetE(int a) {
+  return a + 1;
+}
+
+// Both variants consume the pipeline into a plain value, as a caller
+// folding results would; the input vectors' size is a power of two.
+template <typename T>
+static void run_maybe(
+  BenchHarness& harness,
+  std::string const& suffix,
+  std::vector<T> const& inputs
+) {
+  harness.run("Maybe<" + suffix + " [branchy]",
+    [&inputs, i = std::size_t{0}]() mutable {
+      return (Maybe<T>{inputs[i++ & (inputs.size() - 1)]}
+        | nonNegativeM<T> | scaleM<T> | boundedM<T> | offsetM<T>).value_or(-1);
+    }
+  );
+  harness.run("Maybe<" + suffix + " [branchless]",
+    [&inputs, i = std::size_t{0}]() mutable {
+      return (with_branchless(Maybe<T>{inputs[i++ & (inputs.size() - 1)]})
+        | nonNegativeM<T> | scaleM<T> | boundedM<T> | offsetM<T>).value_or(-1);
+    }
+  );
+
+  AdaptiveSelector selector{"bench"};
+  harness.run("Maybe<" + suffix + " [adaptive]",
+    [&inputs, &selector, i = std::size_t{0}]() mutable {
+      Maybe<T> in{inputs[i++ & (inputs.size() - 1)]};
+      return run_adaptive_or(selector, in, T{-1}, [](auto m) {
+        return std::move(m)
+          | nonNegativeM<T> | scaleM<T> | boundedM<T> | offsetM<T>;
+      });
+    }
+  );
+}
+
+// ============================================================================
+// Main function section
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+  BenchHarness harness{argc, argv};
+
+  for (double rate : {0.0, 0.01, 0.5}) {
+    std::string suffix = "> x4, "
+      + std::to_string(static_cast<int>(rate * 100)) + "%";
+
+    auto ints = make_inputs<int>(rate);
+    run_maybe(harness, "int" + suffix, ints);
+    run_maybe(harness, "double" + suffix, make_inputs<double>(rate));
+
+    harness.run("Either<int" + suffix + " [branchy]",
+      [&ints, i = std::size_t{0}]() mutable {
+        auto r = Either<int>{ints[i++ & (ints.size() - 1)]}
+          | nonNegativeE | scaleE | boundedE | offsetE;
+        auto const* v = std::get_if<0>(&r);
+
+        return nullptr != v ? *v : -1;
+      }
+    );
+    harness.run("Either<int" + suffix + " [branchless]",
+      [&ints, i = std::size_t{0}]() mutable {
+        return (with_branchless(Either<int>{ints[i++ & (ints.size() - 1)]})
+          | nonNegativeE | scaleE | boundedE | offsetE).value_or(-1);
+      }
+    );
+
+    AdaptiveSelector selector{"bench"};
+    harness.run("Either<int" + suffix + " [adaptive]",
+      [&ints, &selector, i = std::size_t{0}]() mutable {
+        Either<int> in{ints[i++ & (ints.size() - 1)]};
+        return run_adaptive_or(selector, in, -1, [](auto e) {
+          return std::move(e) | nonNegativeE | scaleE | boundedE | offsetE;
+        });
+      }
+    );
+  }
+
+  run_maybe(harness, "int> x4, phased", make_phased_inputs());
+
+  return harness.finish();
+}
+
+// End of 'BenchBranchless.cpp'
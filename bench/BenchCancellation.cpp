@@ -0,0 +1,126 @@
+// ============================================================================
+// Benchmark measuring the per-stage cost of cancellation checks.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BenchCancellation.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Benchmark source
+#include "Cancellation.h"
+
+// Standard library headers
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// ============================================================================
+// Benchmark fixtures section
+// ============================================================================
+
+// Prevents the compiler from discarding benchmark results.
+static volatile int sink = 0;
+
+// Number of stages in each measured pipeline.
+static constexpr int kStages = 8;
+
+// Kept out of line so that the pipelines are not folded into a constant and
+// the measured difference is the cost of the checks alone.
+[[gnu::noinline]] static Either<int> step(int a) {
+  return a + 1;
+}
+
+static Either<int> plain(int a) {
+  return Either<int>{a}
+    | step | step | step | step
+    | step | step | step | step;
+}
+
+static Either<int> cancellable(int a, CancellationToken const& token) {
+  return (with_cancellation(Either<int>{a}, token)
+    | step | step | step | step
+    | step | step | step | step).result();
+}
+
+// Runs 'fn' and returns the time per iteration in nanoseconds.
+template <typename F>
+static double measure(long iterations, F fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; ++i) {
+    auto r = fn(static_cast<int>(i));
+    sink = sink + static_cast<int>(r.index());
+  }
+  auto stop = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::nano>(stop - start).count()
+    / iterations;
+}
+
+
+// ============================================================================
+// Main function section
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+  long iterations = 1 < argc ? std::atol(argv[1]) : 10000000;
+
+  CancellationSource source{};
+  CancellationSource timed{};
+  timed.cancel_after(std::chrono::hours{1});
+
+  auto pending_token = source.token();
+  auto deadline_token = timed.token();
+
+  double base = measure(iterations, plain);
+  double pending = measure(iterations, [&](int a) {
+    return cancellable(a, pending_token);
+  });
+  double deadline = measure(iterations, [&](int a) {
+    return cancellable(a, deadline_token);
+  });
+
+  std::printf("# %ld iterations, %d stages\n", iterations, kStages);
+  std::printf("%-28s %10.2f ns/iter\n", "operator|", base);
+  std::printf(
+    "%-28s %10.2f ns/iter %8.3f ns/stage\n",
+    "cancellable, no deadline",
+    pending,
+    (pending - base) / kStages
+  );
+  std::printf(
+    "%-28s %10.2f ns/iter %8.3f ns/stage\n",
+    "cancellable, with deadline",
+    deadline,
+    (deadline - base) / kStages
+  );
+
+  return EXIT_SUCCESS;
+}
+
+// End of 'BenchCancellation.cpp'
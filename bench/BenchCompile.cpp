@@ -0,0 +1,319 @@
+// ============================================================================
+// Benchmark measuring the build cost of generated Maybe and Either chains.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BenchCompile.cpp: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard library headers
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <elf.h>
+#endif
+
+// ============================================================================
+// Benchmark fixtures section
+// ============================================================================
+
+namespace fs = std::filesystem;
+
+// A generated translation unit: 'chains' distinct chains of 'length' stages.
+// Compact ones are built with the Either error paths shared out of line.
+struct ChainsConfig {
+  std::size_t chains;
+  std::size_t length;
+  bool either;
+  bool compact;
+};
+
+// What building a generated translation unit cost.
+struct BuildCost {
+  double seconds = 0.0;
+  long instantiations = -1;      // From -ftime-trace; clang only
+  long weak_functions = -1;      // Emitted template instantiations
+  std::uintmax_t text_bytes = 0;
+  std::uintmax_t object_bytes = 0;
+};
+
+// Writes a translation unit with a payload type per chain and a distinct
+// lambda per stage, so every stage instantiates its own mbind. Like most
+// real pipelines, only every fourth stage validates and can fail; the
+// others transform.
+static std::string generate(ChainsConfig const& config) {
+  std::ostringstream out{};
+  out << "#include \"" << (config.either ? "Either.h" : "Maybe.h")
+      << "\"\n\n";
+
+  for (std::size_t i = 0; i < config.chains; ++i) {
+    std::string payload = "Payload" + std::to_string(i);
+    std::string monad = (config.either ? "Either<" : "Maybe<") + payload + ">";
+
+    out << "struct " << payload << " { int value; };\n\n"
+        << monad << " chain" << i << "(" << monad << " m) {\n"
+        << "  return std::move(m)";
+    for (std::size_t j = 0; j < config.length; ++j) {
+      out << "\n    | [](" << payload << " p) -> " << monad << " {\n";
+      if (0 == j % 4) {
+        out << "        if (-" << j << " == p.value) {\n"
+            << "          return "
+            << (config.either ? "Err{\"Failed\"}" : "{}") << ";\n"
+            << "        }\n";
+      }
+      out << "        return " << payload << "{p.value + " << j + 1 << "};\n"
+          << "      }";
+    }
+    out << ";\n}\n\n";
+  }
+
+  return out.str();
+}
+
+#if defined(__clang__)
+// Counts the occurrences of 'what' in 's'; only clang writes the time trace
+// the instantiations are counted in.
+static long occurrences(std::string const& s, std::string const& what) {
+  long count = 0;
+  for (auto pos = s.find(what); std::string::npos != pos;
+       pos = s.find(what, pos + what.size())) {
+    ++count;
+  }
+
+  return count;
+}
+#endif
+
+// Reads the size of the executable sections and the number of weak
+// functions, which are the emitted template instantiations, of an ELF
+// object file.
+static void inspect_object(fs::path const& object, BuildCost& cost) {
+#if defined(__linux__)
+  std::ifstream in{object, std::ios::binary};
+  std::vector<char> data{std::istreambuf_iterator<char>{in}, {}};
+
+  Elf64_Ehdr header;
+  if (sizeof(header) > data.size()
+      || 0 != std::memcmp(data.data(), ELFMAG, SELFMAG)
+      || ELFCLASS64 != data[EI_CLASS]) {
+    return;
+  }
+  std::memcpy(&header, data.data(), sizeof(header));
+
+  cost.weak_functions = 0;
+  for (std::size_t i = 0; i < header.e_shnum; ++i) {
+    Elf64_Shdr section;
+    std::size_t at = header.e_shoff + i * header.e_shentsize;
+    if (at + sizeof(section) > data.size()) {
+      return;
+    }
+    std::memcpy(&section, data.data() + at, sizeof(section));
+
+    if (0 != (section.sh_flags & SHF_EXECINSTR)) {
+      cost.text_bytes += section.sh_size;
+    }
+    if (SHT_SYMTAB != section.sh_type
+        || section.sh_offset + section.sh_size > data.size()) {
+      continue;
+    }
+
+    for (std::size_t s = 0; s < section.sh_size / sizeof(Elf64_Sym); ++s) {
+      Elf64_Sym symbol;
+      std::memcpy(
+        &symbol,
+        data.data() + section.sh_offset + s * sizeof(symbol),
+        sizeof(symbol)
+      );
+      if (STT_FUNC == ELF64_ST_TYPE(symbol.st_info)
+          && STB_WEAK == ELF64_ST_BIND(symbol.st_info)) {
+        ++cost.weak_functions;
+      }
+    }
+  }
+#else
+  static_cast<void>(object);
+  static_cast<void>(cost);
+#endif
+}
+
+// Generates and compiles the translation unit for 'config' in 'directory'.
+static bool build(
+  ChainsConfig const& config,
+  std::string const& flags,
+  fs::path const& directory,
+  BuildCost& cost
+) {
+  std::string name = std::string{config.either ? "either" : "maybe"}
+    + (config.compact ? "_compact_" : "_") + std::to_string(config.chains)
+    + "x" + std::to_string(config.length);
+  fs::path source = directory / (name + ".cpp");
+  fs::path object = directory / (name + ".o");
+
+  {
+    std::ofstream out{source};
+    out << generate(config);
+    if (!out) {
+      return false;
+    }
+  }
+
+  std::string command = std::string{"\""} + BENCH_COMPILE_CXX + "\" -std=c++"
+    + BENCH_COMPILE_STD + " " + flags + " -I\"" + BENCH_COMPILE_INCLUDE
+    + "\" -c \"" + source.string() + "\" -o \"" + object.string() + "\"";
+  if (config.compact) {
+    command += " -DMAYBE_EITHER_COMPACT_ERRORS";
+  }
+#if defined(__clang__)
+  command += " -ftime-trace -ftime-trace-granularity=0";
+#endif
+
+  auto start = std::chrono::steady_clock::now();
+  int status = std::system(command.c_str());
+  cost.seconds = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - start
+  ).count();
+  if (0 != status) {
+    return false;
+  }
+
+  cost.object_bytes = fs::file_size(object);
+  inspect_object(object, cost);
+
+#if defined(__clang__)
+  std::ifstream trace{fs::path{object}.replace_extension(".json")};
+  std::string json{std::istreambuf_iterator<char>{trace}, {}};
+  if (!json.empty()) {
+    cost.instantiations = occurrences(json, "\"name\":\"InstantiateFunction\"")
+      + occurrences(json, "\"name\":\"InstantiateClass\"");
+  }
+#endif
+
+  return true;
+}
+
+static std::string optional(long value) {
+  return 0 > value ? "-" : std::to_string(value);
+}
+
+
+// ============================================================================
+// Main function section
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+  std::vector<ChainsConfig> configs{};
+  std::string flags = BENCH_COMPILE_FLAGS;
+  ChainsConfig single{0, 0, true, false};
+  bool keep = false;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg{argv[i]};
+    bool has_value = i + 1 < argc;
+
+    if (has_value && "--chains" == arg) {
+      single.chains = std::strtoul(argv[++i], nullptr, 10);
+    } else if (has_value && "--length" == arg) {
+      single.length = std::strtoul(argv[++i], nullptr, 10);
+    } else if (has_value && "--monad" == arg) {
+      single.either = "maybe" != std::string{argv[++i]};
+    } else if (has_value && "--flags" == arg) {
+      flags = argv[++i];
+    } else if ("--compact" == arg) {
+      single.compact = true;
+    } else if ("--keep" == arg) {
+      keep = true;
+    }
+  }
+
+  if (0 != single.chains) {
+    configs.push_back(single);
+  } else {
+    // The empty translation units give the cost of parsing the headers.
+    // Maybe has no error to propagate, so only Either is built compact too.
+    for (auto [either, compact] : {std::pair<bool, bool>{false, false},
+                                   {true, false}, {true, true}}) {
+      for (auto [chains, length] : {std::pair<std::size_t, std::size_t>{0, 0},
+                                    {10, 4}, {20, 8}, {40, 16}}) {
+        configs.push_back({chains, length, either, compact});
+      }
+    }
+  }
+
+  auto directory = fs::temp_directory_path()
+    / ("bench_compile_" + std::to_string(std::chrono::steady_clock::now()
+         .time_since_epoch().count()));
+  fs::create_directories(directory);
+
+  std::printf("# %s -std=c++%s %s\n", BENCH_COMPILE_CXX, BENCH_COMPILE_STD,
+              flags.c_str());
+  std::printf("%-8s %-8s %7s %7s %10s %15s %12s %12s %14s\n", "monad",
+              "mode", "chains",
+              "length", "compile s", "instantiations", "weak funcs",
+              "text bytes", "object bytes");
+
+  int status = EXIT_SUCCESS;
+  for (auto const& config : configs) {
+    BuildCost cost{};
+    if (!build(config, flags, directory, cost)) {
+      std::fprintf(stderr, "Failed to build %zu chains of %zu stages\n",
+                   config.chains, config.length);
+      status = EXIT_FAILURE;
+      break;
+    }
+
+    std::printf("%-8s %-8s %7zu %7zu %10.2f %15s %12s %12ju %14ju\n",
+                config.either ? "Either" : "Maybe",
+                config.compact ? "compact" : "default", config.chains,
+                config.length, cost.seconds,
+                optional(cost.instantiations).c_str(),
+                optional(cost.weak_functions).c_str(),
+                cost.text_bytes, cost.object_bytes);
+  }
+
+  if (keep) {
+    std::printf("# sources kept in %s\n", directory.string().c_str());
+  } else {
+    fs::remove_all(directory);
+  }
+
+  return status;
+}
+
+// End of 'BenchCompile.cpp'
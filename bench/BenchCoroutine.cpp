@@ -0,0 +1,177 @@
+// ============================================================================
+// Benchmark comparing coroutine do-notation with operator| chains.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BenchCoroutine.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Benchmark source
+#include "MaybeEitherCoroutine.h"
+
+// Standard library headers
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+
+// ============================================================================
+// Benchmark fixtures section
+// ============================================================================
+
+// Payload large enough that a stray copy shows up in the timings.
+using Payload = std::array<int, 32>;
+
+// Prevents the compiler from discarding benchmark results.
+static volatile int sink = 0;
+
+// Stage that fails when the payload is tagged as bad.
+static Maybe<Payload> checkM(Payload const& p) {
+  if (p[0] < 0) {
+    return {};
+  }
+
+  return p;
+}
+
+static Maybe<Payload> scaleM(Payload const& p) {
+  Payload r{};
+  for (std::size_t i = 0; i < p.size(); ++i) r[i] = 2 * p[i];
+  return r;
+}
+
+static Maybe<int> sumM(Payload const& p) {
+  return std::accumulate(p.begin(), p.end(), 0);
+}
+
+static Either<Payload> checkE(Payload const& p) {
+  if (p[0] < 0) {
+    return Err{"Negative payload"};
+  }
+
+  return p;
+}
+
+static Either<Payload> scaleE(Payload const& p) {
+  Payload r{};
+  for (std::size_t i = 0; i < p.size(); ++i) r[i] = 2 * p[i];
+  return r;
+}
+
+static Either<int> sumE(Payload const& p) {
+  return std::accumulate(p.begin(), p.end(), 0);
+}
+
+static Maybe<int> pipeM(Payload const& p) {
+  return Maybe<Payload>{p} | checkM | scaleM | scaleM | sumM;
+}
+
+static MaybeTask<int> coroM(Payload const& p) {
+  Payload c = co_await checkM(p);
+  Payload s1 = co_await scaleM(c);
+  Payload s2 = co_await scaleM(s1);
+  co_return co_await sumM(s2);
+}
+
+static Either<int> pipeE(Payload const& p) {
+  return Either<Payload>{p} | checkE | scaleE | scaleE | sumE;
+}
+
+static EitherTask<int> coroE(Payload const& p) {
+  Payload c = co_await checkE(p);
+  Payload s1 = co_await scaleE(c);
+  Payload s2 = co_await scaleE(s1);
+  co_return co_await sumE(s2);
+}
+
+// Runs the coroutines, converting their tasks into their results.
+static Maybe<int> runCoroM(Payload const& p) {
+  return coroM(p);
+}
+
+static Either<int> runCoroE(Payload const& p) {
+  return coroE(p);
+}
+
+// Runs 'fn' over alternating good and bad payloads and prints ns/iteration.
+template <typename F>
+static void measure(char const* name, long iterations, int error_every, F fn) {
+  Payload good{};
+  good.fill(1);
+  Payload bad = good;
+  bad[0] = -1;
+
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; ++i) {
+    bool fail = 0 != error_every && 0 == i % error_every;
+    auto r = fn(fail ? bad : good);
+    sink = sink + static_cast<int>(r.index());
+  }
+  auto stop = std::chrono::steady_clock::now();
+
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf("%-28s %10.2f ns/iter\n", name, ns / iterations);
+}
+
+// Adapts a Maybe-returning function to the 'index()' interface used above.
+template <typename F>
+static auto as_indexed(F f) {
+  return [f](Payload const& p) {
+    struct { std::size_t i; std::size_t index() const { return i; } } r{
+      f(p).has_value() ? 0u : 1u
+    };
+    return r;
+  };
+}
+
+
+// ============================================================================
+// Main function section
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+  long iterations = 1 < argc ? std::atol(argv[1]) : 2000000;
+
+  for (int error_every : {0, 2}) {
+    std::printf(
+      "# %ld iterations, %s\n",
+      iterations,
+      0 == error_every ? "no failures" : "50% failures"
+    );
+    measure("maybe operator|", iterations, error_every, as_indexed(pipeM));
+    measure("maybe co_await", iterations, error_every, as_indexed(runCoroM));
+    measure("either operator|", iterations, error_every, pipeE);
+    measure("either co_await", iterations, error_every, runCoroE);
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// End of 'BenchCoroutine.cpp'
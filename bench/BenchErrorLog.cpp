@@ -0,0 +1,109 @@
+// ============================================================================
+// Benchmark measuring the cost of logging an error event.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BenchErrorLog.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Benchmark source
+#include "ErrorLog.h"
+
+// Standard library headers
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+// ============================================================================
+// Benchmark fixtures section
+// ============================================================================
+
+// Prevents the compiler from discarding benchmark results.
+static volatile std::size_t sink = 0;
+
+// Logs 'iterations' errors and returns the time per event in nanoseconds.
+// Events are logged in bursts small enough for the drain thread to keep up,
+// so none are dropped.
+static double measure(long iterations) {
+  Err const error{"Failed to create 'ExpensiveToCopy'"};
+  double total = 0.0;
+
+  for (long done = 0; done < iterations;) {
+    long burst = std::min<long>(ErrorRing::kCapacity / 2, iterations - done);
+
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < burst; ++i) {
+      sink = sink + std::strlen(LOG_ERROR(error).what());
+    }
+    total += std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start
+    ).count();
+
+    done += burst;
+    if (ErrorLog::instance().enabled()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{2});
+    }
+  }
+
+  return total / iterations;
+}
+
+
+// ============================================================================
+// Main function section
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+  long iterations = 1 < argc ? std::atol(argv[1]) : 1000000;
+  std::string path = 2 < argc ? argv[2] : "bench_error_log.log";
+
+  double disabled = measure(iterations);
+
+  ErrorLog::instance().start(path, 64, std::chrono::milliseconds{1});
+  double sampled = measure(iterations);
+  ErrorLog::instance().stop();
+
+  ErrorLog::instance().start(path, 1, std::chrono::milliseconds{1});
+  double every = measure(iterations);
+  ErrorLog::instance().stop();
+  std::remove(path.c_str());
+
+  std::printf("# %ld events\n", iterations);
+  std::printf("%-32s %10.2f ns/event\n", "log stopped", disabled);
+  std::printf("%-32s %10.2f ns/event\n", "log running, 1/64 messages", sampled);
+  std::printf("%-32s %10.2f ns/event\n", "log running, every message", every);
+
+  return EXIT_SUCCESS;
+}
+
+// End of 'BenchErrorLog.cpp'
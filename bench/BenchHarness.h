@@ -0,0 +1,732 @@
+// ============================================================================
+// Provides a statistical micro-benchmark harness for the monadic types.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BenchHarness.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "AllocationCounters.h"
+#include "HardwareCounters.h"
+
+// Standard library headers
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <ostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Makes the compiler assume \p value is read, so the computation
+ * producing it can't be optimized away.
+ * -------------------------------------------------------------------------- */
+template <typename T>
+inline void do_not_optimize(T const& value) {
+#if defined(__GNUC__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static_cast<void>(*static_cast<char const volatile*>(
+    static_cast<void const*>(&value)
+  ));
+#endif
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Makes the compiler assume all memory is read and written, so stores
+ * can't be elided or moved across the call.
+ * -------------------------------------------------------------------------- */
+inline void clobber() {
+#if defined(__GNUC__)
+  asm volatile("" : : : "memory");
+#else
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Pins the calling thread to \p cpu; -1 means the CPU it currently
+ * runs on.
+ * @return The CPU pinned to, or -1 where pinning isn't supported.
+ * -------------------------------------------------------------------------- */
+inline int pin_to_cpu(int cpu = -1) {
+#if defined(__linux__)
+  if (0 > cpu) {
+    cpu = sched_getcpu();
+  }
+  if (0 > cpu) {
+    return -1;
+  }
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+
+  return 0 == sched_setaffinity(0, sizeof(set), &set) ? cpu : -1;
+#else
+  static_cast<void>(cpu);
+
+  return -1;
+#endif
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief How `BenchHarness` measures a benchmark.
+ * -------------------------------------------------------------------------- */
+struct BenchOptions {
+  double warmup_seconds = 0.05;     // Running time before sampling
+  double sample_seconds = 0.01;     // Minimal running time of a sample
+  std::size_t samples = 30;         // Samples taken per benchmark
+  double outlier_mads = 3.0;        // Rejection threshold, in scaled MADs
+  std::size_t resamples = 1000;     // Bootstrap resamples
+  double confidence = 0.95;         // Level of the confidence interval
+  int cpu = -1;                     // CPU to pin to; -1 the current one
+  bool pin = true;                  // Whether to pin at all
+  std::string filter{};             // Run only names containing this
+  std::string json{};               // Write the results to this file
+  std::string baseline{};           // Compare with the results in this file
+  double tolerance = 0.10;          // Slowdown allowed when not in the file
+  bool update_baseline = false;     // Rewrite the baseline, don't compare
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Statistics of one benchmark, all times in nanoseconds per call.
+ * -------------------------------------------------------------------------- */
+struct BenchResult {
+  std::string name;
+  std::uint64_t iterations;       // Calls per sample
+  std::size_t samples;            // Samples kept after outlier rejection
+  std::size_t rejected;           // Samples rejected as outliers
+  double mean;
+  double median;
+  double stddev;
+  double min;
+  double ci_low;                  // Bootstrap confidence interval of the
+  double ci_high;                 // mean
+  double allocations;             // Allocations per call; -1 if not counted
+  double allocated_bytes;         // Bytes allocated per call; -1 likewise
+  long peak_rss_kb;               // Growth of the peak RSS; -1 if unknown
+  double branch_misses;           // Per call; -1 without hardware counters
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Results read back from a JSON file written by `BenchHarness`.
+ * -------------------------------------------------------------------------- */
+struct BenchBaseline {
+  struct Entry {
+    double mean;
+    double ci_low;
+    double ci_high;
+    double tolerance;             // Allowed slowdown; negative if not set
+  };
+
+  double reference_ns = 0.0;      // Timing of the reference workload
+  std::map<std::string, Entry> benchmarks{};
+
+  /** -------------------------------------------------------------------------
+   * @brief Reads the file at \p path into \p baseline. Only the layout
+   * `write_json()` produces, one benchmark per line, is understood.
+   * @return false if the file can't be opened.
+   * ------------------------------------------------------------------------ */
+  static bool read(std::string const& path, BenchBaseline& baseline) {
+    std::ifstream in{path};
+    if (!in) {
+      return false;
+    }
+
+    for (std::string line; std::getline(in, line);) {
+      baseline.reference_ns
+        = number(line, "reference_ns", baseline.reference_ns);
+
+      auto name = line.find("{\"name\": \"");
+      if (std::string::npos == name) {
+        continue;
+      }
+
+      std::string key{};
+      for (auto i = name + 10; i < line.size() && '"' != line[i]; ++i) {
+        if ('\\' == line[i] && i + 1 < line.size()) {
+          ++i;
+        }
+        key += line[i];
+      }
+
+      baseline.benchmarks[key] = Entry{
+        number(line, "mean_ns"),
+        number(line, "ci_low_ns"),
+        number(line, "ci_high_ns"),
+        number(line, "tolerance", -1.0)
+      };
+    }
+
+    return true;
+  }
+
+private:
+  static double number(
+    std::string const& line,
+    char const* key,
+    double otherwise = 0.0
+  ) {
+    std::string pattern = std::string{"\""} + key + "\": ";
+    auto at = line.find(pattern);
+
+    return std::string::npos == at
+      ? otherwise
+      : std::strtod(line.c_str() + at + pattern.size(), nullptr);
+  }
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Runs micro-benchmarks and summarizes them statistically.
+ *
+ * For every benchmark the harness runs the code for a warmup period, then
+ * calibrates the number of calls per sample so that a sample lasts at least
+ * `sample_seconds`, and takes `samples` samples. Samples further than
+ * `outlier_mads` scaled median absolute deviations from the median are
+ * rejected; the confidence interval of the mean of the rest is estimated
+ * by bootstrap resampling. The thread is pinned to one CPU for the whole
+ * run, so it doesn't migrate between samples.
+ *
+ * The harness also reports the allocations and bytes allocated per call
+ * when the program includes `CountingNew.h`, and by how much the benchmark
+ * raised the peak resident set size, and the branch misses per call where
+ * hardware counters are available.
+ *
+ * Given a baseline file the harness also acts as a regression gate; see
+ * `compare()`. Running with `--update-baseline` rewrites the baseline with
+ * the new results, keeping the tolerances set in it.
+ *
+ * @code
+ * int main(int argc, char* argv[]) {
+ *   BenchHarness harness{argc, argv};
+ *   harness.run("Either bind", [] { return Either<int>{1} | increment; });
+ *   return harness.finish();
+ * }
+ * @endcode
+ * -------------------------------------------------------------------------- */
+class BenchHarness {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit BenchHarness(BenchOptions options = {})
+    : options_(std::move(options)) {
+    pin();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Creates a harness configured from the command line:
+   * `--json FILE`, `--filter TEXT`, `--samples N`, `--sample-seconds S`,
+   * `--warmup-seconds S`, `--cpu N`, `--no-pin`, `--baseline FILE`,
+   * `--tolerance X` and `--update-baseline`.
+   * ------------------------------------------------------------------------ */
+  BenchHarness(int argc, char* argv[]) : options_(parse(argc, argv)) {
+    pin();
+  }
+
+  virtual ~BenchHarness() = default;
+
+  BenchOptions const& options() const noexcept { return options_; }
+
+  std::vector<BenchResult> const& results() const noexcept {
+    return results_;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief CPU the harness is pinned to, or -1.
+   * ------------------------------------------------------------------------ */
+  int cpu() const noexcept { return cpu_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Benchmarks calling \p f; a returned value is kept alive with
+   * `do_not_optimize()`.
+   * @return false if the benchmark was filtered out.
+   * ------------------------------------------------------------------------ */
+  template <typename F>
+  bool run(std::string const& name, F&& f) {
+    if (std::string::npos == name.find(options_.filter)) {
+      return false;
+    }
+
+    results_.push_back(measure(name, f));
+    on_result(results_.back());
+
+    return true;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Median time of the reference workload, a fixed chain of
+   * dependent integer operations, measured on first use.
+   * ------------------------------------------------------------------------ */
+  double reference_ns() {
+    if (0.0 == reference_ns_) {
+      reference_ns_ = measure("reference", reference_work).median;
+    }
+
+    return reference_ns_;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Compares the results with \p baseline and prints a table of the
+   * differences to \p out.
+   *
+   * The baseline timings are first scaled by the ratio of the reference
+   * workload timings, so a slower or busier machine doesn't fail every
+   * benchmark. A benchmark regresses only when the lower end of its
+   * confidence interval lies above the upper end of the baseline's,
+   * widened by the benchmark's tolerance, so noise within the measured
+   * spread never fails the gate.
+   *
+   * @return The number of regressed benchmarks.
+   * ------------------------------------------------------------------------ */
+  std::size_t compare(BenchBaseline const& baseline, std::ostream& out) {
+    double scale = 0.0 < baseline.reference_ns
+      ? reference_ns() / baseline.reference_ns
+      : 1.0;
+
+    out << "# baseline scaled by " << format_ns(scale) << "\n"
+        << std::left << std::setw(36) << "benchmark" << std::right
+        << std::setw(14) << "baseline ns" << std::setw(12) << "mean ns"
+        << std::setw(10) << "change" << std::setw(11) << "tolerance"
+        << std::setw(11) << "status" << "\n";
+
+    std::size_t regressions = 0;
+    for (auto const& r : results_) {
+      auto found = baseline.benchmarks.find(r.name);
+      if (baseline.benchmarks.end() == found) {
+        out << std::left << std::setw(36) << r.name << std::right
+            << std::setw(14) << "-" << std::setw(12) << format_ns(r.mean)
+            << std::setw(10) << "-" << std::setw(11) << "-"
+            << std::setw(11) << "new" << "\n";
+        continue;
+      }
+
+      auto const& b = found->second;
+      double change = 100.0 * (r.mean / (b.mean * scale) - 1.0);
+      double tolerance = 0.0 <= b.tolerance ? b.tolerance : options_.tolerance;
+      char const* status = "ok";
+      if (r.ci_low > b.ci_high * scale * (1.0 + tolerance)) {
+        status = "REGRESSED";
+        ++regressions;
+      } else if (r.ci_high < b.ci_low * scale * (1.0 - tolerance)) {
+        status = "faster";
+      }
+
+      out << std::left << std::setw(36) << r.name << std::right
+          << std::setw(14) << format_ns(b.mean * scale)
+          << std::setw(12) << format_ns(r.mean)
+          << std::setw(9) << format_ns(change) << "%"
+          << std::setw(10) << format_ns(100.0 * tolerance) << "%"
+          << std::setw(11) << status << "\n";
+    }
+
+    return regressions;
+  }
+
+
+  /** -------------------------------------------------------------------------
+   * @brief Prints the results as a table to \p out.
+   * ------------------------------------------------------------------------ */
+  void print(std::ostream& out) const {
+    out << std::left << std::setw(36) << "benchmark" << std::right
+        << std::setw(12) << "mean ns" << std::setw(24) << "95% CI ns"
+        << std::setw(12) << "median ns" << std::setw(10) << "stddev"
+        << std::setw(10) << "outliers" << std::setw(10) << "allocs"
+        << std::setw(12) << "bytes" << std::setw(12) << "peak KiB"
+        << std::setw(10) << "br-miss" << "\n";
+    for (auto const& r : results_) {
+      print_row(out, r);
+    }
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Writes the options and results as JSON to \p out.
+   * ------------------------------------------------------------------------ */
+  void write_json(std::ostream& out) const {
+    out << "{\n  \"context\": {\"cpu\": " << cpu_
+        << ", \"samples\": " << options_.samples
+        << ", \"sample_seconds\": " << options_.sample_seconds
+        << ", \"confidence\": " << options_.confidence
+        << ", \"reference_ns\": " << reference_ns_ << "},\n"
+        << "  \"benchmarks\": [";
+    for (std::size_t i = 0; i < results_.size(); ++i) {
+      auto const& r = results_[i];
+      out << (0 == i ? "\n" : ",\n") << "    {\"name\": \""
+          << escape(r.name) << "\", \"iterations\": " << r.iterations
+          << ", \"samples\": " << r.samples
+          << ", \"rejected\": " << r.rejected
+          << std::setprecision(6) << std::fixed
+          << ", \"mean_ns\": " << r.mean
+          << ", \"median_ns\": " << r.median
+          << ", \"stddev_ns\": " << r.stddev
+          << ", \"min_ns\": " << r.min
+          << ", \"ci_low_ns\": " << r.ci_low
+          << ", \"ci_high_ns\": " << r.ci_high
+          << ", \"allocations\": " << json_optional(r.allocations)
+          << ", \"allocated_bytes\": " << json_optional(r.allocated_bytes)
+          << ", \"peak_rss_delta_kb\": " << json_optional(r.peak_rss_kb)
+          << ", \"branch_misses\": " << json_optional(r.branch_misses)
+          << std::defaultfloat;
+
+      auto found = baseline_.benchmarks.find(r.name);
+      if (baseline_.benchmarks.end() != found
+          && 0.0 <= found->second.tolerance) {
+        out << ", \"tolerance\": " << found->second.tolerance;
+      }
+      out << "}";
+    }
+    out << "\n  ]\n}\n";
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Ends a benchmark program: prints the table to stdout, compares
+   * the results with the baseline and writes the JSON file, as requested.
+   * @return The exit status for `main`; a failure if any benchmark
+   * regressed.
+   * ------------------------------------------------------------------------ */
+  int finish() {
+    print(std::cout);
+
+    int status = EXIT_SUCCESS;
+    if (!options_.baseline.empty()
+        && !BenchBaseline::read(options_.baseline, baseline_)
+        && !options_.update_baseline) {
+      std::cerr << "Can't read the baseline '" << options_.baseline << "'\n";
+      return EXIT_FAILURE;
+    }
+
+    if (!options_.baseline.empty() && !options_.update_baseline) {
+      std::cout << "\n";
+      if (0 < compare(baseline_, std::cout)) {
+        status = EXIT_FAILURE;
+      }
+    }
+
+    auto const& path = options_.update_baseline
+      ? options_.baseline
+      : options_.json;
+    if (!path.empty()) {
+      reference_ns();
+
+      std::ofstream out{path};
+      write_json(out);
+      if (!out) {
+        status = EXIT_FAILURE;
+      }
+    }
+
+    return status;
+  }
+
+protected:
+  /** -------------------------------------------------------------------------
+   * @brief Called with every new result; lets derived harnesses attach
+   * their own measurements.
+   * ------------------------------------------------------------------------ */
+  virtual void on_result(BenchResult const&) { }
+
+  virtual void print_row(std::ostream& out, BenchResult const& r) const {
+    std::string ci = format_ns(r.ci_low) + " .. " + format_ns(r.ci_high);
+    out << std::left << std::setw(36) << r.name << std::right
+        << std::setw(12) << format_ns(r.mean) << std::setw(24) << ci
+        << std::setw(12) << format_ns(r.median)
+        << std::setw(10) << format_ns(r.stddev)
+        << std::setw(10) << r.rejected
+        << std::setw(10) << format_optional(r.allocations)
+        << std::setw(12) << format_optional(r.allocated_bytes)
+        << std::setw(12) << format_optional(r.peak_rss_kb)
+        << std::setw(10) << format_optional(r.branch_misses) << "\n";
+  }
+
+  static std::string format_ns(double ns) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.2f", ns);
+
+    return buffer;
+  }
+
+  // Formats a per-call figure, or "-" if it wasn't measured.
+  static std::string format_optional(double value) {
+    return 0.0 > value ? "-" : format_ns(value);
+  }
+
+  static std::string format_optional(long value) {
+    return 0 > value ? "-" : std::to_string(value);
+  }
+
+  // Writes a figure that wasn't measured as null.
+  template <typename T>
+  static std::string json_optional(T value) {
+    if (0 > value) {
+      return "null";
+    }
+
+    std::ostringstream out{};
+    out << std::setprecision(6) << std::fixed << value;
+
+    return out.str();
+  }
+
+  static std::string escape(std::string const& text) {
+    std::string result{};
+    for (char c : text) {
+      if ('"' == c || '\\' == c) {
+        result += '\\';
+      }
+      result += c;
+    }
+
+    return result;
+  }
+
+private:
+  template <typename F>
+  BenchResult measure(std::string const& name, F& f) {
+    auto batch = [&f](std::uint64_t n) {
+      auto start = Clock::now();
+      for (std::uint64_t i = 0; i < n; ++i) {
+        if constexpr (std::is_void_v<std::invoke_result_t<F&>>) {
+          f();
+          clobber();
+        } else {
+          do_not_optimize(f());
+        }
+      }
+
+      return std::chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    auto& allocations = AllocationCounters::instance();
+    long rss_before = reset_peak_rss() ? rss_kb() : peak_rss_kb();
+
+    std::uint64_t n = calibrate(batch);
+
+    std::vector<double> samples(options_.samples);
+    std::uint64_t count = allocations.count();
+    std::uint64_t bytes = allocations.bytes();
+    std::uint64_t misses = branch_misses_.read();
+    for (auto& sample : samples) {
+      sample = batch(n) * 1e9 / n;
+    }
+    misses = branch_misses_.read() - misses;
+    double calls = static_cast<double>(n) * samples.size();
+    count = allocations.count() - count;
+    bytes = allocations.bytes() - bytes;
+    long peak = peak_rss_kb();
+
+    auto r = summarize(name, n, std::move(samples));
+    if (allocations.interposed()) {
+      r.allocations = count / calls;
+      r.allocated_bytes = bytes / calls;
+    }
+    if (branch_misses_.valid()) {
+      r.branch_misses = misses / calls;
+    }
+    if (0 <= rss_before && 0 <= peak) {
+      r.peak_rss_kb = std::max(0L, peak - rss_before);
+    }
+
+    return r;
+  }
+
+  // Dependent multiply-xorshift steps the compiler can't shortcut.
+  static std::uint64_t reference_work() {
+    static volatile std::uint64_t seed = 1;
+    std::uint64_t x = seed;
+    for (int i = 0; i < 64; ++i) {
+      x = (x ^ (x >> 29)) * 0xBF58476D1CE4E5B9ull;
+    }
+
+    return x;
+  }
+
+  static BenchOptions parse(int argc, char* argv[]) {
+    BenchOptions options{};
+    for (int i = 1; i < argc; ++i) {
+      std::string arg{argv[i]};
+      bool has_value = i + 1 < argc;
+
+      if ("--no-pin" == arg) {
+        options.pin = false;
+      } else if (has_value && "--json" == arg) {
+        options.json = argv[++i];
+      } else if (has_value && "--filter" == arg) {
+        options.filter = argv[++i];
+      } else if (has_value && "--samples" == arg) {
+        options.samples = std::max(3, std::atoi(argv[++i]));
+      } else if (has_value && "--sample-seconds" == arg) {
+        options.sample_seconds = std::atof(argv[++i]);
+      } else if (has_value && "--warmup-seconds" == arg) {
+        options.warmup_seconds = std::atof(argv[++i]);
+      } else if (has_value && "--cpu" == arg) {
+        options.cpu = std::atoi(argv[++i]);
+      } else if (has_value && "--baseline" == arg) {
+        options.baseline = argv[++i];
+      } else if (has_value && "--tolerance" == arg) {
+        options.tolerance = std::atof(argv[++i]);
+      } else if ("--update-baseline" == arg) {
+        options.update_baseline = true;
+      }
+    }
+
+    return options;
+  }
+
+  void pin() {
+    cpu_ = options_.pin ? pin_to_cpu(options_.cpu) : -1;
+  }
+
+  // Warms up, then doubles the calls per sample until a sample lasts long
+  // enough.
+  template <typename Batch>
+  std::uint64_t calibrate(Batch& batch) const {
+    std::uint64_t n = 1;
+    for (double spent = 0.0; spent < options_.warmup_seconds;) {
+      spent += batch(n);
+      n *= 2;
+    }
+
+    n = 1;
+    while (true) {
+      double seconds = batch(n);
+      if (seconds >= options_.sample_seconds) {
+        return n;
+      }
+
+      // Grow towards the target in one step once the timing is reliable.
+      double factor = 1e-4 < seconds
+        ? 1.2 * options_.sample_seconds / seconds
+        : 10.0;
+      n = static_cast<std::uint64_t>(
+        std::ceil(n * std::min(10.0, std::max(factor, 1.5)))
+      );
+    }
+  }
+
+  BenchResult summarize(
+    std::string const& name,
+    std::uint64_t n,
+    std::vector<double> samples
+  ) const {
+    auto median_of = [](std::vector<double> values) {
+      std::sort(values.begin(), values.end());
+      std::size_t mid = values.size() / 2;
+
+      return 0 == values.size() % 2
+        ? (values[mid - 1] + values[mid]) / 2.0
+        : values[mid];
+    };
+
+    double median = median_of(samples);
+    std::vector<double> deviations{};
+    for (double s : samples) {
+      deviations.push_back(std::abs(s - median));
+    }
+    double mad = 1.4826 * median_of(deviations);
+
+    std::vector<double> kept{};
+    for (double s : samples) {
+      if (0.0 == mad || std::abs(s - median) <= options_.outlier_mads * mad) {
+        kept.push_back(s);
+      }
+    }
+
+    BenchResult r{name, n, kept.size(), samples.size() - kept.size(),
+                  0.0, median_of(kept), 0.0, 0.0, 0.0, 0.0,
+                  -1.0, -1.0, -1, -1.0};
+    r.mean = mean_of(kept);
+    r.min = *std::min_element(kept.begin(), kept.end());
+    for (double s : kept) {
+      r.stddev += (s - r.mean) * (s - r.mean);
+    }
+    r.stddev = 1 < kept.size() ? std::sqrt(r.stddev / (kept.size() - 1)) : 0.0;
+
+    // Bootstrap the mean with a fixed seed so reruns on the same samples
+    // give the same interval.
+    std::mt19937_64 random{0x5EED};
+    std::uniform_int_distribution<std::size_t> pick{0, kept.size() - 1};
+    std::vector<double> means(options_.resamples);
+    std::vector<double> resample(kept.size());
+    for (auto& m : means) {
+      for (auto& s : resample) {
+        s = kept[pick(random)];
+      }
+      m = mean_of(resample);
+    }
+    std::sort(means.begin(), means.end());
+    double tail = (1.0 - options_.confidence) / 2.0;
+    r.ci_low = means[static_cast<std::size_t>(tail * (means.size() - 1))];
+    r.ci_high
+      = means[static_cast<std::size_t>((1.0 - tail) * (means.size() - 1))];
+
+    return r;
+  }
+
+  static double mean_of(std::vector<double> const& values) {
+    double sum = 0.0;
+    for (double v : values) {
+      sum += v;
+    }
+
+    return sum / values.size();
+  }
+
+  BenchOptions options_;
+  int cpu_ = -1;
+  double reference_ns_ = 0.0;
+  HardwareCounter branch_misses_{HardwareCounter::branch_misses()};
+  BenchBaseline baseline_{};
+  std::vector<BenchResult> results_;
+};
+
+// End of 'BenchHarness.h'
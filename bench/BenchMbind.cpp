@@ -0,0 +1,95 @@
+// ============================================================================
+// Benchmarks of binding Maybe and Either chains on the statistical harness.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BenchMbind.cpp: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Benchmark source
+#include "BenchHarness.h"
+#include "CountingNew.h"
+#include "Either.h"
+#include "Maybe.h"
+
+// Standard library headers
+#include <cstdlib>
+
+// ============================================================================
+// Benchmark fixtures section
+// ============================================================================
+
+// Read through a volatile, so the compiler can't fold the chains.
+static volatile int input = 1;
+
+static Maybe<int> incrementM(int a) {
+  return a + 1;
+}
+
+static Maybe<int> rejectM(int) {
+  return std::nullopt;
+}
+
+static Either<int> incrementE(int a) {
+  return a + 1;
+}
+
+static Either<int> rejectE(int) {
+  return Err{"Rejected"};
+}
+
+// ============================================================================
+// Main function section
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+  BenchHarness harness{argc, argv};
+
+  harness.run("Maybe bind x4", [] {
+    return Maybe<int>{input} | incrementM | incrementM | incrementM
+      | incrementM;
+  });
+  harness.run("Maybe bind x4, nothing at 2", [] {
+    return Maybe<int>{input} | incrementM | rejectM | incrementM
+      | incrementM;
+  });
+  harness.run("Either bind x4", [] {
+    return Either<int>{input} | incrementE | incrementE | incrementE
+      | incrementE;
+  });
+  harness.run("Either bind x4, error at 2", [] {
+    return Either<int>{input} | incrementE | rejectE | incrementE
+      | incrementE;
+  });
+
+  return harness.finish();
+}
+
+// End of 'BenchMbind.cpp'
@@ -0,0 +1,109 @@
+// ============================================================================
+// Benchmark measuring the cost of capturing an error stack trace.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BenchStackTrace.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Benchmark source
+#include "Either.h"
+
+// Standard library headers
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// ============================================================================
+// Benchmark fixtures section
+// ============================================================================
+
+// Prevents the compiler from discarding benchmark results.
+static volatile std::size_t sink = 0;
+
+// Calls 'f' from 'depth' nested frames, so traces have a realistic depth.
+template <typename F>
+__attribute__((noinline)) std::size_t nested(int depth, F const& f) {
+  if (0 < depth) {
+    std::size_t r = nested(depth - 1, f);
+    asm volatile("" ::: "memory");  // Keep the call out of tail position
+
+    return r;
+  }
+
+  return f();
+}
+
+// Runs 'f' 'iterations' times 'depth' frames deep and returns the time per
+// call in nanoseconds.
+template <typename F>
+static double measure(long iterations, int depth, F const& f) {
+  return nested(depth, [&] {
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i) {
+      sink = sink + f();
+    }
+
+    return static_cast<std::size_t>(std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start
+    ).count() / iterations * 100.0);
+  }) / 100.0;
+}
+
+
+// ============================================================================
+// Main function section
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+  long iterations = 1 < argc ? std::atol(argv[1]) : 1000000;
+  int depth = 2 < argc ? std::atoi(argv[2]) : 16;
+
+  auto walk = measure(iterations, depth, [] {
+    void* frames[StackTrace::kMaxFrames];
+    return walk_frame_pointers(frames, StackTrace::kMaxFrames);
+  });
+  auto unwind = measure(iterations, depth, [] {
+    void* frames[StackTrace::kMaxFrames];
+    return unwind_frames(frames, StackTrace::kMaxFrames);
+  });
+  auto error = measure(iterations, depth, [] {
+    Err e{"Failed to create 'ExpensiveToCopy'"};
+    return e.stack_trace()->depth();
+  });
+
+  std::printf("# %ld captures, %d frames deep\n", iterations, depth);
+  std::printf("%-32s %10.2f ns/capture\n", "frame pointer walk", walk);
+  std::printf("%-32s %10.2f ns/capture\n", "backtrace()", unwind);
+  std::printf("%-32s %10.2f ns/capture\n", "Err with stack trace", error);
+
+  return EXIT_SUCCESS;
+}
+
+// End of 'BenchStackTrace.cpp'
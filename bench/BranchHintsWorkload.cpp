@@ -0,0 +1,140 @@
+// ============================================================================
+// Maybe and Either workloads built under one branch hint policy.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BranchHintsWorkload.cpp: created.
+//
+// ============================================================================
+
+
+// This file is compiled once per branch hint policy. BRANCH_HINTS_POLICY
+// selects it, whatever the build-wide policy is: 0 expects success, 1
+// expects failure and 2 gives no hints. BRANCH_HINTS_REGISTER names the
+// function registering the workloads.
+
+#undef MAYBE_EITHER_EXPECT_FAILURE
+#undef MAYBE_EITHER_NO_BRANCH_HINTS
+#if 1 == BRANCH_HINTS_POLICY
+#define MAYBE_EITHER_EXPECT_FAILURE
+#elif 2 == BRANCH_HINTS_POLICY
+#define MAYBE_EITHER_NO_BRANCH_HINTS
+#endif
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Benchmark source
+#include "BenchHarness.h"
+#include "Either.h"
+#include "Maybe.h"
+
+// Standard library headers
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Benchmark fixtures section
+// ============================================================================
+
+// Every object built from this file instantiates mbind with its own hints.
+// Keeping the payload in an unnamed namespace gives those instantiations
+// internal linkage, so the linker can't merge them across policies.
+namespace {
+
+struct Value {
+  int v;
+};
+
+}  // namespace
+
+static char const* const kPolicy[] = {"success", "failure", "none"};
+
+// Inputs of which 'failure_rate' are negative, in a random order too long
+// for the branch predictor to learn.
+static std::vector<Value> make_inputs(double failure_rate) {
+  std::mt19937 random{42};
+  std::bernoulli_distribution fails{failure_rate};
+
+  std::vector<Value> inputs(1u << 16);
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    inputs[i].v = fails(random) ? -1 : static_cast<int>(i);
+  }
+
+  return inputs;
+}
+
+static Maybe<Value> checkM(Value a) {
+  if (0 > a.v) {
+    return std::nullopt;
+  }
+
+  return a;
+}
+
+static Maybe<Value> incrementM(Value a) {
+  return Value{a.v + 1};
+}
+
+// Failures copy a prepared error, so the allocation of a new message
+// doesn't swamp the cost of the branches.
+static Err const negative{"Negative"};
+
+static Either<Value> checkE(Value a) {
+  if (0 > a.v) {
+    return negative;
+  }
+
+  return a;
+}
+
+static Either<Value> incrementE(Value a) {
+  return Value{a.v + 1};
+}
+
+// ============================================================================
+// Registration section
+// ============================================================================
+
+void BRANCH_HINTS_REGISTER(BenchHarness& harness) {
+  for (double rate : {0.01, 0.5}) {
+    auto inputs = make_inputs(rate);
+    std::string suffix = ", " + std::to_string(static_cast<int>(rate * 100))
+      + "% failing [" + kPolicy[BRANCH_HINTS_POLICY] + "]";
+
+    harness.run("Maybe x4" + suffix, [&inputs, i = std::size_t{0}]() mutable {
+      return Maybe<Value>{inputs[i++ % inputs.size()]}
+        | checkM | incrementM | incrementM | incrementM;
+    });
+    harness.run("Either x4" + suffix, [&inputs, i = std::size_t{0}]() mutable {
+      return Either<Value>{inputs[i++ % inputs.size()]}
+        | checkE | incrementE | incrementE | incrementE;
+    });
+  }
+}
+
+// End of 'BranchHintsWorkload.cpp'
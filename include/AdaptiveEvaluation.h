@@ -0,0 +1,358 @@
+// ============================================================================
+// Switches pipelines between branchy and branchless evaluation at run time.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * AdaptiveEvaluation.h: created.
+//
+// ============================================================================
+
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "BranchHint.h"
+#include "Branchless.h"
+
+// Standard library headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief How an adaptive pipeline evaluates its stages.
+ * -------------------------------------------------------------------------- */
+enum class EvaluationMode {
+  kBranchy,     ///< Stages after a failure are skipped, as by `mbind`.
+  kBranchless   ///< Every stage runs and the outcome is selected.
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Tuning of an `AdaptiveSelector`.
+ *
+ * The selector looks at the failure rate f of each window and at how far it
+ * is from a foregone conclusion, u = min(f, 1 - f). Branchless evaluation
+ * is chosen once u reaches `enter_branchless` and abandoned only when it
+ * drops below `leave_branchless`, so a rate hovering near one threshold
+ * doesn't flip the mode every window.
+ * -------------------------------------------------------------------------- */
+struct AdaptiveOptions {
+  std::uint32_t sample_every = 16;  ///< Record one in this many pipelines.
+  std::uint32_t window = 256;       ///< Samples per decision.
+  double enter_branchless = 0.15;
+  double leave_branchless = 0.05;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief A mode switch made by an `AdaptiveSelector`.
+ * -------------------------------------------------------------------------- */
+struct ModeSwitch {
+  char const* name;         ///< Name of the selector.
+  EvaluationMode from;
+  EvaluationMode to;
+  double failure_rate;      ///< Failure rate of the deciding window.
+  std::uint64_t window;     ///< Index of the deciding window.
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Counts of an `AdaptiveSelector`.
+ * -------------------------------------------------------------------------- */
+struct AdaptiveSnapshot {
+  char const* name;
+  EvaluationMode mode;
+  std::uint64_t windows;    ///< Decisions made so far.
+  std::uint64_t switches;   ///< Decisions that changed the mode.
+  double failure_rate;      ///< Failure rate of the last window.
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Chooses the evaluation mode of the pipelines run with it from their
+ * observed failure rate.
+ *
+ * Pipelines run by `run_adaptive()` read the mode once and report their
+ * outcome when they complete. Only one in `sample_every` outcomes per
+ * thread is recorded, so the usual cost is a thread-local countdown kept
+ * for each selector; every
+ * `window` samples the selector decides on the mode of the pipelines that
+ * follow. A selector may be shared by any number of threads.
+ *
+ * The failure rate stands in for how unpredictable the failures are: a
+ * rate near 0 or 1 is easy on the branch predictor and favours `mbind`,
+ * anything in between favours branchless evaluation. Regular patterns the
+ * predictor can learn are mistaken for random ones.
+ * -------------------------------------------------------------------------- */
+class AdaptiveSelector {
+public:
+  using Listener = std::function<void(ModeSwitch const&)>;
+
+  explicit AdaptiveSelector(
+    char const* name,
+    AdaptiveOptions options = AdaptiveOptions{}
+  ) : name_(name), options_(options) {
+    if (0 == options_.sample_every) {
+      options_.sample_every = 1;
+    }
+    if (0 == options_.window) {
+      options_.window = 1;
+    }
+  }
+
+  AdaptiveSelector(AdaptiveSelector const&) = delete;
+  AdaptiveSelector& operator=(AdaptiveSelector const&) = delete;
+
+  char const* name() const noexcept { return name_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief The mode the next pipeline will be evaluated in.
+   * ------------------------------------------------------------------------ */
+  EvaluationMode mode() const noexcept {
+    return mode_.load(std::memory_order_relaxed);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Calls \p listener, from the deciding thread, on every switch.
+   *
+   * Set it before the selector is used; the listener should be quick, as
+   * the deciding pipeline waits for it.
+   * ------------------------------------------------------------------------ */
+  void on_switch(Listener listener) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    listener_ = std::move(listener);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Reports the outcome of a pipeline.
+   * ------------------------------------------------------------------------ */
+  void record(bool ok) {
+    std::uint32_t& countdown = thread_countdown();
+    if (ON_SUCCESS_PATH(0 != countdown && countdown < options_.sample_every)) {
+      --countdown;
+      return;
+    }
+    countdown = options_.sample_every - 1;
+
+    // Samples count in the high half and failures in the low one, so
+    // recording is one atomic add and doesn't branch on the outcome.
+    std::uint64_t sample = (std::uint64_t{1} << 32) | (ok ? 0u : 1u);
+    auto counts = counts_.fetch_add(sample, std::memory_order_relaxed) + sample;
+    if (options_.window == counts >> 32) {
+      decide();
+    }
+  }
+
+  AdaptiveSnapshot snapshot() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    return {name_, mode(), windows_, switches_, failure_rate_};
+  }
+
+private:
+  /** -------------------------------------------------------------------------
+   * @brief The calling thread's countdown to its next sample for this
+   * selector.
+   *
+   * Each thread keeps the countdowns of the selectors it uses in a small
+   * table indexed by their address. A selector taking over the slot of
+   * another starts with a sample, so colliding selectors sample more often
+   * than asked, never less.
+   * ------------------------------------------------------------------------ */
+  std::uint32_t& thread_countdown() const noexcept {
+    struct Slot {
+      AdaptiveSelector const* owner;
+      std::uint32_t countdown;
+    };
+    static constexpr std::size_t kSlots = 16;
+    thread_local Slot slots[kSlots] = {};
+
+    auto address = reinterpret_cast<std::uintptr_t>(this);
+    Slot& slot = slots[(address >> 6) % kSlots];
+    if (ON_ERROR_PATH(this != slot.owner)) {
+      slot = Slot{this, 0};
+    }
+
+    return slot.countdown;
+  }
+
+  void decide() {
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    // Samples other threads record before the exchange are counted in this
+    // window, so the rate is taken over what was actually exchanged.
+    auto counts = counts_.exchange(0, std::memory_order_relaxed);
+    std::uint64_t samples = counts >> 32;
+    failure_rate_ = 0 == samples
+      ? 0.0
+      : static_cast<double>(counts & 0xffffffffu) / samples;
+
+    double unpredictability = failure_rate_ < 0.5
+      ? failure_rate_
+      : 1.0 - failure_rate_;
+    EvaluationMode from = mode();
+    EvaluationMode to = from;
+    if (EvaluationMode::kBranchy == from
+        && options_.enter_branchless <= unpredictability) {
+      to = EvaluationMode::kBranchless;
+    } else if (EvaluationMode::kBranchless == from
+               && unpredictability < options_.leave_branchless) {
+      to = EvaluationMode::kBranchy;
+    }
+
+    ++windows_;
+    if (from != to) {
+      mode_.store(to, std::memory_order_relaxed);
+      ++switches_;
+      if (listener_) {
+        listener_(ModeSwitch{name_, from, to, failure_rate_, windows_});
+      }
+    }
+  }
+
+  char const* name_;
+  AdaptiveOptions options_;
+  std::atomic<EvaluationMode> mode_{EvaluationMode::kBranchy};
+  alignas(64) std::atomic<std::uint64_t> counts_{0};
+
+  mutable std::mutex mutex_;
+  Listener listener_;
+  std::uint64_t windows_ = 0;
+  std::uint64_t switches_ = 0;
+  double failure_rate_ = 0.0;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Whether the `Maybe`/`Either` \p m holds a value.
+ * -------------------------------------------------------------------------- */
+template <typename T>
+bool adaptive_succeeded(Maybe<T> const& m) noexcept {
+  return m.has_value();
+}
+
+template <typename T>
+bool adaptive_succeeded(Either<T> const& e) noexcept {
+  return 0 == e.index();
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief The value of the `Maybe`/`Either` \p m, or \p fallback.
+ * -------------------------------------------------------------------------- */
+template <typename T>
+T adaptive_value_or(Maybe<T> const& m, T fallback) {
+  return m.value_or(fallback);
+}
+
+template <typename T>
+T adaptive_value_or(Either<T> const& e, T fallback) {
+  auto const* v = std::get_if<0>(&e);
+
+  return nullptr != v ? *v : fallback;
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Runs \p pipeline on \p value in the mode \p selector currently
+ * chooses, and reports the outcome to it.
+ *
+ * The pipeline is a generic callable chaining its stages onto its argument.
+ * It is instantiated twice: once with the `Maybe`/`Either` itself, chaining
+ * through `mbind`, and once with `with_branchless(value)`. The mode is thus
+ * tested once per pipeline, and each mode runs exactly the code it would
+ * run on its own. The stages must meet the requirements of branchless
+ * pipelines.
+ *
+ * @code
+ * static AdaptiveSelector parsing{"parsing"};
+ * auto r = run_adaptive(parsing, Maybe<int>{x}, [](auto m) {
+ *   return std::move(m) | checkM | scaleM;
+ * });
+ * @endcode
+ *
+ * @param selector Chooses the mode and receives the outcome.
+ * @param value The initial `Maybe`/`Either` of a trivially copyable payload.
+ * @param pipeline The stages to run.
+ * @return The `Maybe`/`Either` the pipeline produced.
+ * -------------------------------------------------------------------------- */
+template <typename M, typename Pipeline>
+auto run_adaptive(
+  AdaptiveSelector& selector,
+  M const& value,
+  Pipeline&& pipeline
+) {
+  using Result = std::invoke_result_t<Pipeline&, M>;
+
+  if (EvaluationMode::kBranchless == selector.mode()) {
+    auto state = std::invoke(pipeline, with_branchless(value));
+    selector.record(state.ok());
+
+    return Result{std::move(state).result()};
+  }
+
+  Result r = std::invoke(pipeline, M{value});
+  selector.record(adaptive_succeeded(r));
+
+  return r;
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Like `run_adaptive()`, but folds the outcome into its value or
+ * \p fallback within the chosen mode.
+ *
+ * Taking the `Maybe`/`Either` out of a branchless pipeline and then testing
+ * it brings back the branch the pipeline avoided, so callers that only need
+ * a value should prefer this form.
+ *
+ * @return The value the pipeline produced, or \p fallback if it failed.
+ * -------------------------------------------------------------------------- */
+template <typename M, typename T, typename Pipeline>
+T run_adaptive_or(
+  AdaptiveSelector& selector,
+  M const& value,
+  T fallback,
+  Pipeline&& pipeline
+) {
+  if (EvaluationMode::kBranchless == selector.mode()) {
+    auto state = std::invoke(pipeline, with_branchless(value));
+    selector.record(state.ok());
+
+    return state.value_or(fallback);
+  }
+
+  auto r = std::invoke(pipeline, M{value});
+  selector.record(adaptive_succeeded(r));
+
+  return adaptive_value_or(r, fallback);
+}
+
+// End of 'AdaptiveEvaluation.h'
@@ -0,0 +1,257 @@
+// ============================================================================
+// Provides process-wide heap allocation counters and RSS readings.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * AllocationCounters.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Counts the allocations made through the global `operator new`.
+ *
+ * The counters only move in programs that include `CountingNew.h`, which
+ * replaces the global allocation functions; `interposed()` tells whether
+ * that is the case.
+ *
+ * Every thread counts into a slot of its own, so an allocation costs two
+ * relaxed stores to memory no other thread writes, and threads allocating
+ * at once don't contend for a shared cache line. Reading the counters sums
+ * the slots of the live threads and what the exited threads left behind.
+ * -------------------------------------------------------------------------- */
+class AllocationCounters {
+public:
+  static AllocationCounters& instance() noexcept {
+    static AllocationCounters counters{};
+    return counters;
+  }
+
+  AllocationCounters(AllocationCounters const&) = delete;
+  AllocationCounters& operator=(AllocationCounters const&) = delete;
+
+  void add(std::size_t bytes) noexcept {
+    Slot* slot = local_slot();
+    if (nullptr == slot) {
+      // Allocations made by thread-local destructors running after the
+      // slot of the thread was retired.
+      retired_count_.fetch_add(1, std::memory_order_relaxed);
+      retired_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+      return;
+    }
+
+    // Only the owning thread writes its slot, so no read-modify-write is
+    // needed; readers merely must not see torn values.
+    slot->count.store(
+      slot->count.load(std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed
+    );
+    slot->bytes.store(
+      slot->bytes.load(std::memory_order_relaxed) + bytes,
+      std::memory_order_relaxed
+    );
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Allocations made so far.
+   * ------------------------------------------------------------------------ */
+  std::uint64_t count() const noexcept {
+    std::lock_guard<std::mutex> lock{mutex_};
+    std::uint64_t total = retired_count_.load(std::memory_order_relaxed);
+    for (Slot const* slot = slots_; nullptr != slot; slot = slot->next) {
+      total += slot->count.load(std::memory_order_relaxed);
+    }
+
+    return total;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Bytes requested by the allocations made so far.
+   * ------------------------------------------------------------------------ */
+  std::uint64_t bytes() const noexcept {
+    std::lock_guard<std::mutex> lock{mutex_};
+    std::uint64_t total = retired_bytes_.load(std::memory_order_relaxed);
+    for (Slot const* slot = slots_; nullptr != slot; slot = slot->next) {
+      total += slot->bytes.load(std::memory_order_relaxed);
+    }
+
+    return total;
+  }
+
+  bool interposed() const noexcept {
+    return interposed_.load(std::memory_order_relaxed);
+  }
+
+  void set_interposed() noexcept {
+    interposed_.store(true, std::memory_order_relaxed);
+  }
+
+private:
+  // The counters of one thread, linked into the list of live slots. The
+  // list is intrusive, so registering a thread doesn't allocate from
+  // within operator new.
+  struct Slot {
+    std::atomic<std::uint64_t> count{0};
+    std::atomic<std::uint64_t> bytes{0};
+    Slot* prev = nullptr;
+    Slot* next = nullptr;
+  };
+
+  // Registers the slot of the thread on its first allocation and retires it
+  // when the thread exits.
+  struct ThreadSlot {
+    ThreadSlot() noexcept { instance().link(slot); }
+
+    ~ThreadSlot() {
+      thread_exited_ = true;
+      instance().retire(slot);
+    }
+
+    Slot slot;
+  };
+
+  constexpr AllocationCounters() noexcept = default;
+
+  static Slot* local_slot() noexcept {
+    if (thread_exited_) {
+      return nullptr;
+    }
+
+    static thread_local ThreadSlot thread_slot{};
+    return &thread_slot.slot;
+  }
+
+  void link(Slot& slot) noexcept {
+    std::lock_guard<std::mutex> lock{mutex_};
+    slot.next = slots_;
+    if (nullptr != slots_) {
+      slots_->prev = &slot;
+    }
+    slots_ = &slot;
+  }
+
+  void retire(Slot& slot) noexcept {
+    std::lock_guard<std::mutex> lock{mutex_};
+    retired_count_.fetch_add(
+      slot.count.load(std::memory_order_relaxed),
+      std::memory_order_relaxed
+    );
+    retired_bytes_.fetch_add(
+      slot.bytes.load(std::memory_order_relaxed),
+      std::memory_order_relaxed
+    );
+
+    if (nullptr != slot.prev) {
+      slot.prev->next = slot.next;
+    } else {
+      slots_ = slot.next;
+    }
+    if (nullptr != slot.next) {
+      slot.next->prev = slot.prev;
+    }
+  }
+
+  static inline thread_local bool thread_exited_ = false;
+
+  mutable std::mutex mutex_;
+  Slot* slots_ = nullptr;
+  std::atomic<std::uint64_t> retired_count_{0};
+  std::atomic<std::uint64_t> retired_bytes_{0};
+  std::atomic<bool> interposed_{false};
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Reads a "Field:  N kB" line of /proc/self/status.
+ * @return The value in KiB, or -1 where it isn't available.
+ * -------------------------------------------------------------------------- */
+inline long process_status_kb(char const* field) {
+  std::FILE* status = std::fopen("/proc/self/status", "r");
+  if (nullptr == status) {
+    return -1;
+  }
+
+  long kb = -1;
+  char line[256];
+  std::size_t length = std::strlen(field);
+  while (std::fgets(line, sizeof(line), status)) {
+    if (0 == std::strncmp(line, field, length) && ':' == line[length]) {
+      kb = std::strtol(line + length + 1, nullptr, 10);
+      break;
+    }
+  }
+  std::fclose(status);
+
+  return kb;
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Resident set size of the process in KiB, or -1.
+ * -------------------------------------------------------------------------- */
+inline long rss_kb() {
+  return process_status_kb("VmRSS");
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Peak resident set size of the process in KiB, or -1.
+ * -------------------------------------------------------------------------- */
+inline long peak_rss_kb() {
+  return process_status_kb("VmHWM");
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Lowers the peak resident set size to the current one, so the next
+ * `peak_rss_kb()` reflects only what happened since.
+ * @return false where the peak can't be reset; it then still holds the
+ * peak of the whole run.
+ * -------------------------------------------------------------------------- */
+inline bool reset_peak_rss() {
+  std::FILE* clear = std::fopen("/proc/self/clear_refs", "w");
+  if (nullptr == clear) {
+    return false;
+  }
+
+  bool reset = 0 < std::fputs("5", clear);
+
+  return 0 == std::fclose(clear) && reset;
+}
+
+// End of 'AllocationCounters.h'
@@ -0,0 +1,435 @@
+// ============================================================================
+// Provides opt-in per-call-site outcome counters for monadic binds.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BindCounters.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "Either.h"
+#include "Maybe.h"
+
+// Standard library headers
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// Macro Definitions Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Marks a bind site whose outcomes should be counted.
+ *
+ * @code
+ * auto r = create_expensive_e(true)
+ *   | COUNTED(transform_expensive_e)
+ *   | COUNTED(accumulate_expensive_e);
+ * @endcode
+ *
+ * With `MAYBE_EITHER_BIND_COUNTERS` defined (see the `ENABLE_BIND_COUNTERS`
+ * CMake option) every expansion owns a static `BindSite` identified by file,
+ * line and the spelling of the stage. Otherwise the macro expands to its
+ * argument alone, so the generated code is the same as without it.
+ * -------------------------------------------------------------------------- */
+#if defined(MAYBE_EITHER_BIND_COUNTERS)
+#define COUNTED(...)                                                         \
+  counted_stage(                                                             \
+    []() -> BindSite const& {                                                \
+      static BindSite const site{__FILE__, __LINE__, #__VA_ARGS__};          \
+      return site;                                                           \
+    }(),                                                                     \
+    __VA_ARGS__                                                              \
+  )
+#else
+#define COUNTED(...) __VA_ARGS__
+#endif
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Outcomes counted for every bind site.
+ * -------------------------------------------------------------------------- */
+enum BindOutcome : std::size_t {
+  kBindSucceeded = 0,  ///< The stage returned Just/Right.
+  kBindFailed,         ///< The stage returned Nothing/Left.
+  kBindSkipped,        ///< The stage was short-circuited by an earlier failure.
+  kBindOutcomes
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Merged counts of a bind site.
+ * -------------------------------------------------------------------------- */
+struct BindSiteSnapshot {
+  char const* file;
+  int line;
+  char const* label;
+  std::uint64_t succeeded;
+  std::uint64_t failed;
+  std::uint64_t skipped;
+};
+
+class BindSite;
+
+/** ---------------------------------------------------------------------------
+ * @brief Counters of a single thread.
+ *
+ * Only the owning thread writes its shard, so counting is a relaxed load and
+ * store with no read-modify-write. Slots are allocated in chunks on first
+ * use, so a shard costs nothing until the thread reaches a counted site.
+ * When the thread exits its counts are folded into the registry.
+ * -------------------------------------------------------------------------- */
+class BindCounterShard {
+public:
+  // Up to kChunkSize * kMaxChunks ids; see BindCounterRegistry::add_site().
+  static constexpr std::size_t kChunkSize = 256;
+  static constexpr std::size_t kMaxChunks = 256;
+
+  using Slot = std::array<std::atomic<std::uint64_t>, kBindOutcomes>;
+  using Chunk = std::array<Slot, kChunkSize>;
+
+  BindCounterShard();
+  ~BindCounterShard();
+
+  BindCounterShard(BindCounterShard const&) = delete;
+  BindCounterShard& operator=(BindCounterShard const&) = delete;
+
+  /** -------------------------------------------------------------------------
+   * @brief The shard of the calling thread.
+   * ------------------------------------------------------------------------ */
+  static BindCounterShard& local() {
+    thread_local BindCounterShard shard{};
+    return shard;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Counts one \p outcome of the site with the given id.
+   * ------------------------------------------------------------------------ */
+  void count(std::size_t site, BindOutcome outcome) {
+    Chunk* chunk = chunks_[site / kChunkSize].load(std::memory_order_relaxed);
+    if (nullptr == chunk) {
+      chunk = allocate(site / kChunkSize);
+    }
+
+    auto& counter = (*chunk)[site % kChunkSize][outcome];
+    counter.store(
+      counter.load(std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed
+    );
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Reads the counts of the site with the given id; callable from any
+   * thread while the registry lock is held.
+   * ------------------------------------------------------------------------ */
+  std::uint64_t read(std::size_t site, BindOutcome outcome) const {
+    Chunk const* chunk
+      = chunks_[site / kChunkSize].load(std::memory_order_acquire);
+
+    return nullptr == chunk
+      ? 0
+      : (*chunk)[site % kChunkSize][outcome].load(std::memory_order_relaxed);
+  }
+
+private:
+  Chunk* allocate(std::size_t index) {
+    auto* chunk = new Chunk{};
+    chunks_[index].store(chunk, std::memory_order_release);
+
+    return chunk;
+  }
+
+  std::array<std::atomic<Chunk*>, kMaxChunks> chunks_{};
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Process-wide list of bind sites and live thread shards.
+ *
+ * The registry is only touched when a site is first reached, when a thread
+ * starts or stops counting, and when a snapshot is taken; counting itself
+ * never takes the lock. Sites reached once the shards are full share one
+ * id, reported as the site labelled "other".
+ * -------------------------------------------------------------------------- */
+class BindCounterRegistry {
+public:
+  static constexpr std::size_t kMaxSites
+    = BindCounterShard::kChunkSize * BindCounterShard::kMaxChunks;
+
+  /** -------------------------------------------------------------------------
+   * @brief Id of the sites registered beyond the first `kMaxSites - 1`.
+   * ------------------------------------------------------------------------ */
+  static constexpr std::size_t kOtherSite = kMaxSites - 1;
+
+  static BindCounterRegistry& instance() {
+    static BindCounterRegistry registry{};
+    return registry;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Registers a site, returning its id; `kOtherSite` once the
+   * shards have no slot left for it.
+   * ------------------------------------------------------------------------ */
+  std::size_t add_site(BindSite const* site) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (kOtherSite == sites_.size()) {
+      overflowed_ = true;
+      return kOtherSite;
+    }
+
+    sites_.push_back(site);
+    retired_.push_back({});
+
+    return sites_.size() - 1;
+  }
+
+  void attach(BindCounterShard* shard) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    shards_.push_back(shard);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Folds the counts of an exiting thread into the retired totals.
+   * ------------------------------------------------------------------------ */
+  void detach(BindCounterShard* shard) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    for (std::size_t i = 0; i < sites_.size(); ++i) {
+      for (std::size_t k = 0; k < kBindOutcomes; ++k) {
+        retired_[i][k] += shard->read(i, static_cast<BindOutcome>(k));
+      }
+    }
+    if (overflowed_) {
+      for (std::size_t k = 0; k < kBindOutcomes; ++k) {
+        other_[k] += shard->read(kOtherSite, static_cast<BindOutcome>(k));
+      }
+    }
+
+    for (auto it = shards_.begin(); it != shards_.end(); ++it) {
+      if (*it == shard) {
+        shards_.erase(it);
+        break;
+      }
+    }
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Merges the counts of all threads, in site registration order.
+   * ------------------------------------------------------------------------ */
+  std::vector<BindSiteSnapshot> snapshot() const;
+
+private:
+  BindCounterRegistry() = default;
+
+  mutable std::mutex mutex_;
+  std::vector<BindSite const*> sites_;
+  std::vector<std::array<std::uint64_t, kBindOutcomes>> retired_;
+  std::array<std::uint64_t, kBindOutcomes> other_{};
+  bool overflowed_ = false;
+  std::vector<BindCounterShard*> shards_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Static record of a counted bind site, created by `COUNTED`.
+ * -------------------------------------------------------------------------- */
+class BindSite {
+public:
+  BindSite(char const* file, int line, char const* label)
+    : file_(file),
+      line_(line),
+      label_(label),
+      id_(BindCounterRegistry::instance().add_site(this)) { }
+
+  BindSite(BindSite const&) = delete;
+  BindSite& operator=(BindSite const&) = delete;
+
+  char const* file() const noexcept { return file_; }
+  int line() const noexcept { return line_; }
+  char const* label() const noexcept { return label_; }
+  std::size_t id() const noexcept { return id_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Counts one \p outcome in the calling thread's shard.
+   * ------------------------------------------------------------------------ */
+  void count(BindOutcome outcome) const {
+    BindCounterShard::local().count(id_, outcome);
+  }
+
+private:
+  char const* file_;
+  int line_;
+  char const* label_;
+  std::size_t id_;
+};
+
+inline BindCounterShard::BindCounterShard() {
+  BindCounterRegistry::instance().attach(this);
+}
+
+inline BindCounterShard::~BindCounterShard() {
+  BindCounterRegistry::instance().detach(this);
+  for (auto& chunk : chunks_) {
+    delete chunk.load(std::memory_order_relaxed);
+  }
+}
+
+inline std::vector<BindSiteSnapshot> BindCounterRegistry::snapshot() const {
+  std::lock_guard<std::mutex> lock{mutex_};
+  std::vector<BindSiteSnapshot> result{};
+  result.reserve(sites_.size());
+
+  for (std::size_t i = 0; i < sites_.size(); ++i) {
+    auto counts = retired_[i];
+    for (auto const* shard : shards_) {
+      for (std::size_t k = 0; k < kBindOutcomes; ++k) {
+        counts[k] += shard->read(i, static_cast<BindOutcome>(k));
+      }
+    }
+
+    result.push_back({
+      sites_[i]->file(),
+      sites_[i]->line(),
+      sites_[i]->label(),
+      counts[kBindSucceeded],
+      counts[kBindFailed],
+      counts[kBindSkipped]
+    });
+  }
+
+  if (overflowed_) {
+    auto counts = other_;
+    for (auto const* shard : shards_) {
+      for (std::size_t k = 0; k < kBindOutcomes; ++k) {
+        counts[k] += shard->read(kOtherSite, static_cast<BindOutcome>(k));
+      }
+    }
+
+    result.push_back({
+      "",
+      0,
+      "other",
+      counts[kBindSucceeded],
+      counts[kBindFailed],
+      counts[kBindSkipped]
+    });
+  }
+
+  return result;
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Merged counts of every bind site reached so far by any thread.
+ * -------------------------------------------------------------------------- */
+inline std::vector<BindSiteSnapshot> bind_counters() {
+  return BindCounterRegistry::instance().snapshot();
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief A stage that counts its outcomes at a bind site.
+ *
+ * Invoking it counts whether the wrapped stage succeeded, so it may be
+ * passed to `mbind` directly. Applied with `operator|` it also counts the
+ * times it was short-circuited by an earlier failure.
+ *
+ * @tparam F The type of the wrapped callable.
+ * -------------------------------------------------------------------------- */
+template <typename F>
+class CountedStage {
+public:
+  CountedStage(BindSite const& site, F f)
+    : site_(&site), f_(std::move(f)) { }
+
+  template <typename T>
+  auto operator()(T&& value) const {
+    auto r = std::invoke(f_, std::forward<T>(value));
+    site_->count(succeeded(r) ? kBindSucceeded : kBindFailed);
+
+    return r;
+  }
+
+  BindSite const& site() const noexcept { return *site_; }
+
+private:
+  template <typename T>
+  static bool succeeded(Maybe<T> const& m) noexcept {
+    return m.has_value();
+  }
+
+  template <typename T>
+  static bool succeeded(Either<T> const& e) noexcept {
+    return 0 == e.index();
+  }
+
+  BindSite const* site_;
+  F f_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Wraps \p f so its outcomes are counted at \p site; used by
+ * `COUNTED`.
+ * -------------------------------------------------------------------------- */
+template <typename F>
+auto counted_stage(BindSite const& site, F&& f) {
+  return CountedStage<std::decay_t<F>>{site, std::forward<F>(f)};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Pipe operator applying a counted stage to a `Maybe`.
+ * -------------------------------------------------------------------------- */
+template <typename T, typename F>
+auto operator|(Maybe<T>&& m, CountedStage<F>&& s) {
+  if (ON_ERROR_PATH(!m)) {
+    s.site().count(kBindSkipped);
+  }
+
+  return mbind<T, CountedStage<F> const&>(m, s);
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Pipe operator applying a counted stage to an `Either`.
+ * -------------------------------------------------------------------------- */
+template <typename T, typename F>
+auto operator|(Either<T>&& e, CountedStage<F>&& s) {
+  if (ON_ERROR_PATH(0 != e.index())) {
+    s.site().count(kBindSkipped);
+  }
+
+  return mbind<T, CountedStage<F> const&>(e, s);
+}
+
+// End of 'BindCounters.h'
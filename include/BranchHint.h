@@ -0,0 +1,71 @@
+// ============================================================================
+// Provides the branch hints marking the success and error paths.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BranchHint.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Macro Definitions Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Branch hint policies, selected when building:
+ *
+ * - by default the success path is expected, so compilers lay out the
+ *   Nothing/Err branches out of the fall-through path;
+ * - `MAYBE_EITHER_EXPECT_FAILURE` expects the error path instead, for
+ *   builds whose pipelines mostly reject their input;
+ * - `MAYBE_EITHER_NO_BRANCH_HINTS` leaves the layout to the compiler.
+ *
+ * `ON_SUCCESS_PATH(c)` and `ON_ERROR_PATH(c)` evaluate to the truth value
+ * of `c`, hinted as taken on the success or on the error path.
+ *
+ * @code
+ * if (ON_ERROR_PATH(0 != e.index())) {
+ *   return propagate_error<R>(std::get<Err>(e));
+ * }
+ * @endcode
+ * -------------------------------------------------------------------------- */
+#if defined(MAYBE_EITHER_EXPECT_FAILURE) \
+    && defined(MAYBE_EITHER_NO_BRANCH_HINTS)
+#error "Select at most one branch hint policy"
+#endif
+
+#if defined(MAYBE_EITHER_NO_BRANCH_HINTS) || !defined(__GNUC__)
+#define ON_SUCCESS_PATH(c) static_cast<bool>(c)
+#define ON_ERROR_PATH(c) static_cast<bool>(c)
+#elif defined(MAYBE_EITHER_EXPECT_FAILURE)
+#define ON_SUCCESS_PATH(c) __builtin_expect(static_cast<bool>(c), 0)
+#define ON_ERROR_PATH(c) __builtin_expect(static_cast<bool>(c), 1)
+#else
+#define ON_SUCCESS_PATH(c) __builtin_expect(static_cast<bool>(c), 1)
+#define ON_ERROR_PATH(c) __builtin_expect(static_cast<bool>(c), 0)
+#endif
+
+// End of 'BranchHint.h'
@@ -0,0 +1,367 @@
+// ============================================================================
+// Provides a branchless evaluation mode for pipelines of cheap, pure stages.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * Branchless.h: created.
+//
+// ============================================================================
+
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "BranchHint.h"
+#include "Either.h"
+#include "Maybe.h"
+
+// Standard library headers
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Returns \p v unchanged while hiding its value from the optimizer.
+ *
+ * Without it the compiler knows which way a condition went on each path and
+ * turns the masking below back into jumps.
+ * -------------------------------------------------------------------------- */
+template <typename T>
+T opaque_value(T v) noexcept {
+#if defined(__GNUC__)
+  asm volatile("" : "+r"(v));
+#endif
+
+  return v;
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Returns \p a if \p c holds and \p b otherwise, without branching.
+ *
+ * Both values are combined through a mask derived from \p c, so the
+ * compiler emits a conditional move or a blend rather than a jump.
+ *
+ * @tparam T A trivially copyable type.
+ * -------------------------------------------------------------------------- */
+template <typename T>
+T select_value(bool c, T const& a, T const& b) noexcept {
+  static_assert(
+    std::is_trivially_copyable_v<T>,
+    "branchless selection needs a trivially copyable type"
+  );
+
+  if constexpr (std::is_same_v<T, bool>) {
+    c = opaque_value(c);
+
+    return (c & a) | (!c & b);
+  } else if constexpr (std::is_integral_v<T>) {
+    using U = std::make_unsigned_t<T>;
+    U mask = opaque_value(U{0} - static_cast<U>(c));
+
+    return static_cast<T>(
+      (static_cast<U>(a) & mask) | (static_cast<U>(b) & ~mask)
+    );
+  } else {
+    // Blend the object representations a word at a time.
+    using W = std::conditional_t<
+      0 == sizeof(T) % sizeof(std::uint64_t),
+      std::uint64_t,
+      std::conditional_t<
+        0 == sizeof(T) % sizeof(std::uint32_t),
+        std::uint32_t,
+        unsigned char
+      >
+    >;
+    constexpr std::size_t kWords = sizeof(T) / sizeof(W);
+
+    W wa[kWords];
+    W wb[kWords];
+    std::memcpy(wa, &a, sizeof(T));
+    std::memcpy(wb, &b, sizeof(T));
+
+    W mask = opaque_value(W{0} - static_cast<W>(c));
+    for (std::size_t i = 0; i < kWords; ++i) {
+      wa[i] = (wa[i] & mask) | (wb[i] & static_cast<W>(~mask));
+    }
+
+    T r;
+    std::memcpy(&r, wa, sizeof(T));
+
+    return r;
+  }
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Reads the payload of the stage result \p r, or `R{}` if it holds
+ * none.
+ *
+ * The payload is read through `value_or()`, as the layout of
+ * `std::optional` is left to the standard library. For the trivially
+ * copyable payloads of branchless pipelines the compiler selects rather
+ * than branches, and callers mask the value out when \p r holds none.
+ * -------------------------------------------------------------------------- */
+template <typename R>
+R speculative_value(Maybe<R> const& r) noexcept {
+  return r.value_or(R{});
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Reads the payload of the stage result \p r, or `R{}` if it holds
+ * an error.
+ *
+ * Hiding the index of an `Either` would also hide it from the destructor of
+ * \p r, which then costs more than the branch it saves, so the payload is
+ * read through `get_if` and left to the compiler to select.
+ * -------------------------------------------------------------------------- */
+template <typename R>
+R speculative_value(Either<R> const& r) noexcept {
+  R const* v = std::get_if<0>(&r);
+
+  return nullptr != v ? *v : R{};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Whether \p T can be carried by a branchless pipeline.
+ * -------------------------------------------------------------------------- */
+template <typename T>
+inline constexpr bool is_branchless_payload_v =
+  std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>;
+
+/** ---------------------------------------------------------------------------
+ * @brief A `Maybe` or `Either` evaluated without a branch per stage.
+ *
+ * Created with `with_branchless()`. Instead of testing the carried value
+ * before each stage, the pipeline always invokes the next stage and folds
+ * its outcome into a success flag; once a stage has failed the following
+ * ones run on a value-initialized payload and their results are discarded.
+ * For cheap stages on arithmetic payloads this trades a little wasted work
+ * for the mispredictions of failure patterns the predictor can't learn.
+ *
+ * Stages must therefore be pure and defined for every input, including
+ * `T{}`, and the payloads must be trivially copyable. Stages whose cost or
+ * side effects matter belong in an ordinary pipeline.
+ *
+ * @tparam M The monadic type currently carried (`Maybe<T>` or `Either<T>`).
+ * -------------------------------------------------------------------------- */
+template <typename M>
+class Branchless;
+
+template <typename T>
+class Branchless<Maybe<T>> {
+  static_assert(
+    is_branchless_payload_v<T>,
+    "branchless pipelines need trivially copyable, default constructible "
+    "payloads"
+  );
+
+public:
+  Branchless(T value, bool ok) noexcept : value_(value), ok_(ok) { }
+
+  /** -------------------------------------------------------------------------
+   * @brief The carried value; only meaningful while `ok()` holds.
+   * ------------------------------------------------------------------------ */
+  T const& value() const noexcept { return value_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Whether every stage so far has succeeded.
+   * ------------------------------------------------------------------------ */
+  bool ok() const noexcept { return ok_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief The carried value, or \p fallback if a stage failed.
+   * ------------------------------------------------------------------------ */
+  T value_or(T fallback) const noexcept {
+    return select_value(ok_, value_, fallback);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Releases the carried `Maybe` at the end of a pipeline.
+   *
+   * Resetting an engaged `Maybe` rather than choosing between two returns
+   * lets the compiler build the result without a jump as well.
+   * ------------------------------------------------------------------------ */
+  Maybe<T> result() const noexcept {
+    Maybe<T> r{value_};
+    if (!ok_) {
+      r.reset();
+    }
+
+    return r;
+  }
+
+private:
+  T value_;
+  bool ok_;
+};
+
+template <typename T>
+class Branchless<Either<T>> {
+  static_assert(
+    is_branchless_payload_v<T>,
+    "branchless pipelines need trivially copyable, default constructible "
+    "payloads"
+  );
+
+public:
+  Branchless(T value, bool ok, std::unique_ptr<Err> error) noexcept
+    : value_(value), ok_(ok), error_(std::move(error)) { }
+
+  /** -------------------------------------------------------------------------
+   * @brief The carried value; only meaningful while `ok()` holds.
+   * ------------------------------------------------------------------------ */
+  T const& value() const noexcept { return value_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Whether every stage so far has succeeded.
+   * ------------------------------------------------------------------------ */
+  bool ok() const noexcept { return ok_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief The carried value, or \p fallback if a stage failed.
+   * ------------------------------------------------------------------------ */
+  T value_or(T fallback) const noexcept {
+    return select_value(ok_, value_, fallback);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Records the error of the first failing stage.
+   * ------------------------------------------------------------------------ */
+  void fail(Err&& err) {
+    ok_ = false;
+    error_ = std::make_unique<Err>(std::move(err));
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Hands the recorded error, if any, over to the next stage.
+   * ------------------------------------------------------------------------ */
+  std::unique_ptr<Err> take_error() noexcept { return std::move(error_); }
+
+  /** -------------------------------------------------------------------------
+   * @brief Releases the carried `Either` at the end of a pipeline.
+   * ------------------------------------------------------------------------ */
+  Either<T> result() && {
+    if (ON_SUCCESS_PATH(ok_)) {
+      return value_;
+    }
+
+    return Either<T>(std::in_place_index<1>, std::move(*error_));
+  }
+
+private:
+  T value_;
+  bool ok_;
+  // Boxed, so passing the carrier on to the next stage moves a pointer
+  // instead of testing and moving an error at every stage.
+  std::unique_ptr<Err> error_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Starts a pipeline of \p value evaluated without a branch per stage.
+ *
+ * @code
+ * auto r = (with_branchless(Maybe<int>{x})
+ *   | checkM
+ *   | scaleM
+ *   | clampM).result();
+ * @endcode
+ *
+ * @param value The initial `Maybe`/`Either` of a trivially copyable payload.
+ * @return The value wrapped in a `Branchless`.
+ * -------------------------------------------------------------------------- */
+template <typename T>
+auto with_branchless(Maybe<T> const& value) {
+  return Branchless<Maybe<T>>{value.value_or(T{}), value.has_value()};
+}
+
+template <typename T>
+auto with_branchless(Either<T> const& value) {
+  if (ON_ERROR_PATH(0 != value.index())) {
+    return Branchless<Either<T>>{
+      T{},
+      false,
+      std::make_unique<Err>(*std::get_if<1>(&value))
+    };
+  }
+
+  return Branchless<Either<T>>{*std::get_if<0>(&value), true, nullptr};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Pipe operator running the next stage of a branchless `Maybe`
+ * pipeline.
+ *
+ * The stage is invoked whether or not an earlier one failed, and its
+ * outcome is combined into the success flag with a bitwise and. Nothing
+ * but the stage can throw.
+ * -------------------------------------------------------------------------- */
+template <
+  typename T,
+  typename F,
+  typename R = typename std::invoke_result_t<F, T>::value_type
+>
+auto operator|(Branchless<Maybe<T>>&& b, F&& f)
+  noexcept(std::is_nothrow_invocable_r_v<Maybe<R>, F, T>) {
+  Maybe<R> r = std::invoke(std::forward<F>(f), b.value());
+  R v = speculative_value(r);
+  bool ok = b.ok() & r.has_value();
+
+  return Branchless<Maybe<R>>{select_value(ok, v, R{}), ok};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Pipe operator running the next stage of a branchless `Either`
+ * pipeline.
+ *
+ * Only the first failure takes a branch, to keep its error; the stages
+ * after it run speculatively and their errors are dropped.
+ * -------------------------------------------------------------------------- */
+template <typename T, typename F>
+auto operator|(Branchless<Either<T>>&& b, F&& f) {
+  using R = typename std::variant_alternative_t<0, std::invoke_result_t<F, T>>;
+
+  Either<R> r = std::invoke(std::forward<F>(f), b.value());
+  R v = speculative_value(r);
+  bool ok = b.ok() & (0 == r.index());
+
+  Branchless<Either<R>> next{select_value(ok, v, R{}), ok, b.take_error()};
+  if (ON_ERROR_PATH(b.ok() & !ok)) {
+    next.fail(std::move(*std::get_if<1>(&r)));
+  }
+
+  return next;
+}
+
+// End of 'Branchless.h'
@@ -0,0 +1,475 @@
+// ============================================================================
+// Provides cooperative cancellation for monadic computations.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * Cancellation.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "BranchHint.h"
+#include "Either.h"
+#include "Maybe.h"
+#include "StageHooks.h"
+
+// Standard library headers
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Error reported by computations that were cancelled before they
+ * could complete.
+ * -------------------------------------------------------------------------- */
+inline Err cancelled_error() {
+  return Err{"Operation cancelled", ErrKind::kCancelled};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Error reported by computations stopped because their deadline
+ * passed.
+ * -------------------------------------------------------------------------- */
+inline Err deadline_exceeded_error() {
+  return Err{"Deadline exceeded", ErrKind::kDeadlineExceeded};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Checks whether \p err reports a cancellation rather than a failure
+ * of the computation.
+ * @return true for errors of kind `ErrKind::kCancelled` or
+ * `ErrKind::kDeadlineExceeded`.
+ * -------------------------------------------------------------------------- */
+inline bool is_cancelled(Err const& err) noexcept {
+  return ErrKind::kCancelled == err.kind()
+    || ErrKind::kDeadlineExceeded == err.kind();
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Checks whether \p err reports a passed deadline.
+ * -------------------------------------------------------------------------- */
+inline bool is_deadline_exceeded(Err const& err) noexcept {
+  return ErrKind::kDeadlineExceeded == err.kind();
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Shared state behind a CancellationSource and its tokens.
+ *
+ * Both explicit cancellation and deadline expiry end up in the single
+ * `status` field, so polling a token is one relaxed load whether or not a
+ * deadline is set. Deadlines are turned into a status change by the
+ * `DeadlineTimer` thread rather than by readers looking at the clock.
+ * -------------------------------------------------------------------------- */
+struct CancellationState {
+  using Clock = std::chrono::steady_clock;
+
+  /** -------------------------------------------------------------------------
+   * @brief Cancellation status values.
+   * ------------------------------------------------------------------------ */
+  enum Status : std::uint8_t {
+    kActive = 0,
+    kCancelled = 1,
+    kDeadlineExceeded = 2
+  };
+
+  std::atomic<std::uint8_t> status{kActive};
+
+  /** -------------------------------------------------------------------------
+   * @brief Moves an active state to \p reason; later requests are ignored so
+   * the first reason sticks.
+   * ------------------------------------------------------------------------ */
+  void cancel(Status reason) noexcept {
+    std::uint8_t expected = kActive;
+    status.compare_exchange_strong(
+      expected,
+      reason,
+      std::memory_order_relaxed
+    );
+  }
+
+  bool is_cancelled() const noexcept {
+    return kActive != status.load(std::memory_order_relaxed);
+  }
+
+  bool deadline_passed() const noexcept {
+    return kDeadlineExceeded == status.load(std::memory_order_relaxed);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief A state that is never cancelled, standing in for the missing
+   * state of a default-constructed token so pipelines need no null check.
+   * ------------------------------------------------------------------------ */
+  static CancellationState const* never() noexcept {
+    static CancellationState const state{};
+    return &state;
+  }
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Process-wide timer thread expiring cancellation deadlines.
+ *
+ * The thread is started on first use and sleeps until the earliest pending
+ * deadline. The timer only keeps weak references to the states, so sources
+ * destroyed before their deadline, together with their tokens, are dropped
+ * silently; their entries are purged whenever the number of pending entries
+ * has doubled, so they do not pile up until their deadlines.
+ * -------------------------------------------------------------------------- */
+class DeadlineTimer {
+public:
+  using Clock = CancellationState::Clock;
+
+  /** -------------------------------------------------------------------------
+   * @brief The process-wide timer instance.
+   * ------------------------------------------------------------------------ */
+  static DeadlineTimer& instance() {
+    static DeadlineTimer timer;
+    return timer;
+  }
+
+  DeadlineTimer(DeadlineTimer const&) = delete;
+  DeadlineTimer& operator=(DeadlineTimer const&) = delete;
+
+  ~DeadlineTimer() {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      stopping_ = true;
+    }
+    changed_.notify_one();
+    thread_.join();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Cancels \p state with `kDeadlineExceeded` once \p deadline
+   * passes.
+   * ------------------------------------------------------------------------ */
+  void schedule(
+    Clock::time_point deadline,
+    std::weak_ptr<CancellationState> state
+  ) {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      if (purge_at_ <= pending_.size()) {
+        purge();
+      }
+      pending_.push_back(Entry{deadline, std::move(state)});
+      std::push_heap(pending_.begin(), pending_.end(), std::greater<Entry>{});
+    }
+    changed_.notify_one();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Number of deadlines waiting to expire, including those of states
+   * that have not been purged yet.
+   * ------------------------------------------------------------------------ */
+  std::size_t pending() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return pending_.size();
+  }
+
+private:
+  static constexpr std::size_t kMinPurge = 64;
+
+  struct Entry {
+    Clock::time_point deadline;
+    std::weak_ptr<CancellationState> state;
+
+    bool operator>(Entry const& other) const noexcept {
+      return deadline > other.deadline;
+    }
+  };
+
+  DeadlineTimer() : thread_([this] { run(); }) { }
+
+  void run() {
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (!stopping_) {
+      if (pending_.empty()) {
+        changed_.wait(lock);
+        continue;
+      }
+
+      auto next = pending_.front().deadline;
+      if (Clock::now() < next) {
+        changed_.wait_until(lock, next);
+        continue;
+      }
+
+      std::pop_heap(pending_.begin(), pending_.end(), std::greater<Entry>{});
+      if (auto state = pending_.back().state.lock()) {
+        state->cancel(CancellationState::kDeadlineExceeded);
+      }
+      pending_.pop_back();
+    }
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Drops the entries of states nobody observes any more.
+   * ------------------------------------------------------------------------ */
+  void purge() {
+    pending_.erase(
+      std::remove_if(
+        pending_.begin(),
+        pending_.end(),
+        [](Entry const& e) { return e.state.expired(); }
+      ),
+      pending_.end()
+    );
+    std::make_heap(pending_.begin(), pending_.end(), std::greater<Entry>{});
+    purge_at_ = std::max(kMinPurge, 2 * pending_.size());
+  }
+
+  mutable std::mutex mutex_;
+  std::condition_variable changed_;
+  std::vector<Entry> pending_;  // Min-heap on the deadline
+  std::size_t purge_at_ = kMinPurge;
+  bool stopping_ = false;
+  std::thread thread_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Read-only view of a cancellation request.
+ *
+ * Tokens are cheap to copy and may be polled from any thread. A
+ * default-constructed token is never cancelled.
+ * -------------------------------------------------------------------------- */
+class CancellationToken {
+public:
+  CancellationToken() = default;
+
+  explicit CancellationToken(std::shared_ptr<CancellationState const> state)
+    : state_(std::move(state)) { }
+
+  /** -------------------------------------------------------------------------
+   * @brief Checks whether cancellation has been requested or the deadline
+   * has passed.
+   * @return true if the owning source has been cancelled or its deadline
+   * has passed.
+   * ------------------------------------------------------------------------ */
+  bool is_cancelled() const noexcept {
+    return state_ && state_->is_cancelled();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Checks whether the token was cancelled by its deadline.
+   * @return true if the deadline of the owning source has passed.
+   * ------------------------------------------------------------------------ */
+  bool deadline_passed() const noexcept {
+    return state_ && state_->deadline_passed();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief The observed state, or nullptr for a default-constructed token.
+   * ------------------------------------------------------------------------ */
+  CancellationState const* state() const noexcept {
+    return state_.get();
+  }
+
+private:
+  std::shared_ptr<CancellationState const> state_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Owner of a cancellation request, handing out tokens to the
+ * computations it may cancel.
+ * -------------------------------------------------------------------------- */
+class CancellationSource {
+public:
+  // Not make_shared: the weak reference of the DeadlineTimer would keep the
+  // memory of the state alive until the deadline.
+  CancellationSource() : state_(new CancellationState{}) { }
+
+  /** -------------------------------------------------------------------------
+   * @brief Returns a token observing this source.
+   * ------------------------------------------------------------------------ */
+  CancellationToken token() const {
+    return CancellationToken{state_};
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Requests cancellation of every computation holding a token.
+   * ------------------------------------------------------------------------ */
+  void cancel() noexcept {
+    state_->cancel(CancellationState::kCancelled);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Cancels every computation holding a token once \p deadline
+   * passes.
+   *
+   * A deadline already in the past takes effect immediately; otherwise the
+   * `DeadlineTimer` thread expires it, typically within tens of
+   * microseconds of \p deadline.
+   *
+   * @param deadline The point in time after which tokens report
+   * cancellation.
+   * ------------------------------------------------------------------------ */
+  void set_deadline(CancellationState::Clock::time_point deadline) {
+    if (CancellationState::Clock::now() >= deadline) {
+      state_->cancel(CancellationState::kDeadlineExceeded);
+    } else {
+      DeadlineTimer::instance().schedule(deadline, state_);
+    }
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Cancels every computation holding a token after \p timeout.
+   * @param timeout Time from now after which tokens report cancellation.
+   * ------------------------------------------------------------------------ */
+  template <typename Rep, typename Period>
+  void cancel_after(std::chrono::duration<Rep, Period> timeout) {
+    set_deadline(
+      CancellationState::Clock::now()
+      + std::chrono::duration_cast<CancellationState::Clock::duration>(timeout)
+    );
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Checks whether cancellation has been requested or the deadline
+   * has passed.
+   * ------------------------------------------------------------------------ */
+  bool is_cancelled() const noexcept {
+    return state_->is_cancelled();
+  }
+
+private:
+  std::shared_ptr<CancellationState> state_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief The stage result of a cancelled `Maybe` pipeline: Nothing.
+ * -------------------------------------------------------------------------- */
+template <typename R>
+Maybe<R> cancelled_stage(Maybe<R> const*, CancellationState const*) noexcept {
+  return {};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Builds the stage result of a cancelled `Either` pipeline.
+ *
+ * Kept out of line so the error construction does not bloat every stage of
+ * every pipeline and get in the way of inlining the common path.
+ *
+ * @param state The cancellation state of the pipeline.
+ * @return A `deadline_exceeded_error()` if the deadline passed, otherwise a
+ * `cancelled_error()`.
+ * -------------------------------------------------------------------------- */
+template <typename R>
+#if defined(__GNUC__)
+__attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+__declspec(noinline)
+#endif
+Either<R> cancelled_stage(Either<R> const*, CancellationState const* state) {
+  if (state->deadline_passed()) {
+    return Either<R>(std::in_place_index<1>, deadline_exceeded_error());
+  }
+
+  return Either<R>(std::in_place_index<1>, cancelled_error());
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Stage hook keeping the stages from running once the pipeline has
+ * been cancelled.
+ *
+ * A cancelled `Maybe` pipeline turns into Nothing and an `Either` pipeline
+ * into a cancellation error (see `is_cancelled(Err const&)`); a value that
+ * already failed keeps its original failure. Only a plain pointer to the
+ * state is carried, so the check is a single relaxed load per stage; the
+ * token the hook was made from must outlive the pipeline.
+ * -------------------------------------------------------------------------- */
+class CancellationHook : public StageHook {
+public:
+  /** -------------------------------------------------------------------------
+   * @brief Checks \p state, which must not be null; use
+   * `CancellationState::never()` for a pipeline that cannot be cancelled.
+   * ------------------------------------------------------------------------ */
+  explicit CancellationHook(CancellationState const* state) noexcept
+    : state_(state) { }
+
+  template <typename Out, typename S, typename M, typename Next>
+  Out around(std::size_t, S const&, M&, Next&& next) {
+    if (ON_ERROR_PATH(state_->is_cancelled())) {
+      return cancelled_stage(static_cast<Out const*>(nullptr), state_);
+    }
+
+    return std::forward<Next>(next)();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief The cancellation state checked between stages.
+   * ------------------------------------------------------------------------ */
+  CancellationState const* state() const noexcept { return state_; }
+
+private:
+  CancellationState const* state_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Checks \p token before every stage of the pipeline \p value.
+ *
+ * @code
+ * auto token = source.token();
+ * auto r = (with_cancellation(create_expensive_e(true), token)
+ *   | transform_expensive_e
+ *   | accumulate_expensive_e).result();
+ * @endcode
+ *
+ * Attach it before the other hooks, so a cancelled stage is not timed,
+ * traced or counted as run either.
+ *
+ * @param value A `Maybe`/`Either`, or a pipeline started by another
+ * `with_*()` function.
+ * @param token The token to check before each stage. It must outlive the
+ * pipeline.
+ * -------------------------------------------------------------------------- */
+template <typename M>
+auto with_cancellation(M&& value, CancellationToken const& token) {
+  auto const* state = token.state();
+
+  return attach_hook(
+    std::forward<M>(value),
+    CancellationHook{nullptr != state ? state : CancellationState::never()}
+  );
+}
+
+// End of 'Cancellation.h'
@@ -0,0 +1,68 @@
+// ============================================================================
+// Provides a constexpr-capable std::invoke for the monadic bind operations.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ConstexprInvoke.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Invokes \p f with \p args as `std::invoke` does, also in constant
+ * expressions.
+ *
+ * `std::invoke` is only constexpr from C++20 on. C++17 builds call ordinary
+ * callables directly, which is what `std::invoke` does for them, and leave
+ * pointers to members, which can't be bound at compile time there, to it.
+ * -------------------------------------------------------------------------- */
+template <typename F, typename... Args>
+constexpr decltype(auto) constexpr_invoke(F&& f, Args&&... args)
+  noexcept(std::is_nothrow_invocable_v<F, Args...>) {
+#if __cplusplus >= 202002L
+  return std::invoke(std::forward<F>(f), std::forward<Args>(args)...);
+#else
+  if constexpr (std::is_member_pointer_v<std::decay_t<F>>) {
+    return std::invoke(std::forward<F>(f), std::forward<Args>(args)...);
+  } else {
+    return std::forward<F>(f)(std::forward<Args>(args)...);
+  }
+#endif
+}
+
+// End of 'ConstexprInvoke.h'
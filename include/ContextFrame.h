@@ -0,0 +1,155 @@
+// ============================================================================
+// Provides the shared, reference-counted context frames of Either errors.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ContextFrame.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+#include <utility>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief One breadcrumb attached to an error on its way up a pipeline.
+ *
+ * Frames form an immutable singly linked list from the most recently added
+ * frame to the oldest one. Copies of an error share their frames, which are
+ * reference counted and released to wherever they were allocated from by
+ * `destroy()`. Frames only keep what they need to describe themselves; the
+ * text is produced by `format()` when someone asks for it.
+ * -------------------------------------------------------------------------- */
+class ContextFrame {
+public:
+  ContextFrame(ContextFrame const&) = delete;
+  ContextFrame& operator=(ContextFrame const&) = delete;
+
+  /** -------------------------------------------------------------------------
+   * @brief Writes the text of this frame alone to \p out.
+   * ------------------------------------------------------------------------ */
+  virtual void format(std::ostream& out) const = 0;
+
+  /** -------------------------------------------------------------------------
+   * @brief The frame added before this one, or nullptr.
+   * ------------------------------------------------------------------------ */
+  ContextFrame const* parent() const noexcept { return parent_; }
+
+  void acquire() noexcept {
+    refs_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Drops a reference to \p frame, destroying every frame of the
+   * chain that is no longer referenced.
+   * ------------------------------------------------------------------------ */
+  static void release(ContextFrame* frame) noexcept {
+    while (nullptr != frame
+      && 1 == frame->refs_.fetch_sub(1, std::memory_order_acq_rel)) {
+      ContextFrame* parent = frame->parent_;
+      frame->destroy();
+      frame = parent;
+    }
+  }
+
+protected:
+  /** -------------------------------------------------------------------------
+   * @brief Creates a frame holding one reference, taking over the caller's
+   * reference to \p parent.
+   * ------------------------------------------------------------------------ */
+  explicit ContextFrame(ContextFrame* parent) noexcept : parent_(parent) { }
+
+  virtual ~ContextFrame() = default;
+
+  /** -------------------------------------------------------------------------
+   * @brief Destroys the frame and frees its memory.
+   * ------------------------------------------------------------------------ */
+  virtual void destroy() noexcept = 0;
+
+private:
+  std::atomic<std::size_t> refs_{1};
+  ContextFrame* parent_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Owning handle to the context frames of an error.
+ *
+ * Empty unless context was attached, so errors without context pay only for
+ * a null pointer. Copying shares the frames.
+ * -------------------------------------------------------------------------- */
+class ContextChain {
+public:
+  ContextChain() noexcept = default;
+
+  ContextChain(ContextChain const& other) noexcept : head_(other.head_) {
+    if (nullptr != head_) {
+      head_->acquire();
+    }
+  }
+
+  ContextChain(ContextChain&& other) noexcept
+    : head_(std::exchange(other.head_, nullptr)) { }
+
+  ContextChain& operator=(ContextChain other) noexcept {
+    std::swap(head_, other.head_);
+    return *this;
+  }
+
+  ~ContextChain() {
+    ContextFrame::release(head_);
+  }
+
+  bool empty() const noexcept { return nullptr == head_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief The most recently added frame, or nullptr.
+   * ------------------------------------------------------------------------ */
+  ContextFrame const* head() const noexcept { return head_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Hands the current head over to \p make, which must return a new
+   * frame built on top of it; the new frame becomes the head.
+   * ------------------------------------------------------------------------ */
+  template <typename Make>
+  void push(Make&& make) {
+    head_ = std::forward<Make>(make)(head_);
+  }
+
+private:
+  ContextFrame* head_ = nullptr;
+};
+
+// End of 'ContextFrame.h'
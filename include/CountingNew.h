@@ -0,0 +1,195 @@
+// ============================================================================
+// Replaces the global allocation functions with counting ones.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * CountingNew.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "AllocationCounters.h"
+
+// Standard library headers
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+// Include this header in exactly one translation unit of a program: the
+// replacement allocation functions it defines can't be inline. Every
+// allocation then goes through malloc() and is counted by
+// AllocationCounters.
+
+/** ---------------------------------------------------------------------------
+ * @brief Counts and performs an allocation; marks the counters as
+ * interposed on first use.
+ * -------------------------------------------------------------------------- */
+static void* counted_allocate(
+  std::size_t size,
+  std::size_t alignment
+) noexcept {
+  auto& counters = AllocationCounters::instance();
+  counters.set_interposed();
+  counters.add(size);
+
+  if (0 == size) {
+    size = 1;
+  }
+  if (alignof(std::max_align_t) >= alignment) {
+    return std::malloc(size);
+  }
+
+#if defined(_MSC_VER)
+  return _aligned_malloc(size, alignment);
+#else
+  // aligned_alloc() wants the size to be a multiple of the alignment.
+  return std::aligned_alloc(
+    alignment,
+    (size + alignment - 1) & ~(alignment - 1)
+  );
+#endif
+}
+
+static void counted_free(void* p, std::size_t alignment) noexcept {
+#if defined(_MSC_VER)
+  if (alignof(std::max_align_t) < alignment) {
+    _aligned_free(p);
+    return;
+  }
+#else
+  static_cast<void>(alignment);
+#endif
+  std::free(p);
+}
+
+static void* counted_new(std::size_t size, std::size_t alignment) {
+  while (true) {
+    if (void* p = counted_allocate(size, alignment)) {
+      return p;
+    }
+
+    auto handler = std::get_new_handler();
+    if (nullptr == handler) {
+      throw std::bad_alloc{};
+    }
+    handler();
+  }
+}
+
+// Make sure the counters read as interposed even before the first
+// allocation.
+static bool const counting_new_installed = [] {
+  AllocationCounters::instance().set_interposed();
+  return true;
+}();
+
+constexpr std::size_t kDefaultAlignment = alignof(std::max_align_t);
+
+void* operator new(std::size_t size) {
+  return counted_new(size, kDefaultAlignment);
+}
+
+void* operator new[](std::size_t size) {
+  return counted_new(size, kDefaultAlignment);
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept {
+  return counted_allocate(size, kDefaultAlignment);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept {
+  return counted_allocate(size, kDefaultAlignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return counted_new(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return counted_new(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+  counted_free(p, kDefaultAlignment);
+}
+
+void operator delete[](void* p) noexcept {
+  counted_free(p, kDefaultAlignment);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  counted_free(p, kDefaultAlignment);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+  counted_free(p, kDefaultAlignment);
+}
+
+void operator delete(void* p, std::nothrow_t const&) noexcept {
+  counted_free(p, kDefaultAlignment);
+}
+
+void operator delete[](void* p, std::nothrow_t const&) noexcept {
+  counted_free(p, kDefaultAlignment);
+}
+
+void operator delete(void* p, std::align_val_t alignment) noexcept {
+  counted_free(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* p, std::align_val_t alignment) noexcept {
+  counted_free(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(
+  void* p,
+  std::size_t,
+  std::align_val_t alignment
+) noexcept {
+  counted_free(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](
+  void* p,
+  std::size_t,
+  std::align_val_t alignment
+) noexcept {
+  counted_free(p, static_cast<std::size_t>(alignment));
+}
+
+// End of 'CountingNew.h'
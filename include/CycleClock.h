@@ -0,0 +1,113 @@
+// ============================================================================
+// Provides a low-overhead clock for timing pipeline stages.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * CycleClock.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define MAYBE_EITHER_HAS_RDTSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define MAYBE_EITHER_HAS_RDTSC 1
+#endif
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Tick counter for timing short intervals.
+ *
+ * Reads the time stamp counter where the CPU has one and falls back to
+ * `std::chrono::steady_clock` elsewhere. Ticks are only meaningful as
+ * differences and are converted to nanoseconds with `to_ns()`, which is
+ * calibrated against `steady_clock` over the lifetime of the process.
+ * -------------------------------------------------------------------------- */
+class CycleClock {
+public:
+  /** -------------------------------------------------------------------------
+   * @brief Reads the current tick count.
+   * ------------------------------------------------------------------------ */
+  static std::uint64_t now() noexcept {
+#if defined(MAYBE_EITHER_HAS_RDTSC)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(
+      std::chrono::steady_clock::now().time_since_epoch().count()
+    );
+#endif
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Converts a tick difference into nanoseconds.
+   * ------------------------------------------------------------------------ */
+  static double to_ns(std::uint64_t ticks) {
+    return static_cast<double>(ticks) * ns_per_tick();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Nanoseconds per tick.
+   *
+   * The first call takes a reference point; later calls measure the tick
+   * rate against it, waiting until at least a millisecond has passed so
+   * the ratio is accurate to well under a percent.
+   * ------------------------------------------------------------------------ */
+  static double ns_per_tick() {
+#if defined(MAYBE_EITHER_HAS_RDTSC)
+    using Steady = std::chrono::steady_clock;
+
+    static Steady::time_point const start_time = Steady::now();
+    static std::uint64_t const start_ticks = now();
+
+    Steady::duration elapsed{};
+    std::uint64_t ticks = 0;
+    do {
+      elapsed = Steady::now() - start_time;
+      ticks = now() - start_ticks;
+    } while (elapsed < std::chrono::milliseconds{1} || 0 == ticks);
+
+    return std::chrono::duration<double, std::nano>(elapsed).count() / ticks;
+#else
+    return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::duration{1}
+    ).count();
+#endif
+  }
+};
+
+// End of 'CycleClock.h'
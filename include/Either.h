@@ -26,6 +26,20 @@
 //
 // * Either.h: created.
 //
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * Either.h: Err is now a class derived from std::runtime_error instead of
+//   an alias of it, so that it can carry context frames, its origin, its
+//   kind and a stack trace. This breaks code relying on the two being the
+//   same type: build errors from an Err or a class derived from it rather
+//   than from std::runtime_error directly, and read them back with
+//   std::get<Err> instead of std::get<std::runtime_error>. Handlers taking
+//   a std::runtime_error const& keep working.
+//
+// * Either.h: only includes StackTrace.h in builds defining
+//   MAYBE_EITHER_STACK_TRACES; code reading Err::stack_trace() includes it
+//   itself.
+//
 // ============================================================================
 
 #pragma once
@@ -34,9 +48,22 @@
 // Headers Include Section
 // ============================================================================
 
+// Project headers
+#include "BranchHint.h"
+#include "ConstexprInvoke.h"
+#include "ContextFrame.h"
+#include "ErrorSite.h"
+#include "StackTraceRef.h"
+
+#if defined(MAYBE_EITHER_STACK_TRACES)
+#include "StackTrace.h"
+#endif
+
 // Standard library headers
+#include <cstdint>
 #include <functional>
 #include <stdexcept> // For std::runtime_error
+#include <type_traits>
 #include <utility>   // For std::forward
 #include <variant>
 
@@ -44,10 +71,73 @@
 // Implementation Section
 // ============================================================================
 
+/** ---------------------------------------------------------------------------
+ * @brief Broad category of an `Err`.
+ *
+ * Kept in the `Err` itself, so it survives the error being copied into an
+ * `Either`, which stores a plain `Err` and slices away any derived class.
+ * -------------------------------------------------------------------------- */
+enum class ErrKind : std::uint8_t {
+  kFailure = 0,
+  kCancelled,
+  kDeadlineExceeded
+};
+
 /** ---------------------------------------------------------------------------
  * @brief Defines a common error type for the Either monad.
+ *
+ * A `std::runtime_error` that can additionally carry a chain of context
+ * frames (see `ErrorContext.h`) and the static record of the call site it
+ * was created at (see `MAKE_ERROR`). Each is a single pointer which stays
+ * null until set. Programs with a translation unit built with
+ * `MAYBE_EITHER_STACK_TRACES` also capture the stack whenever an error is
+ * constructed from a message.
+ *
+ * `Err` does not depend on the macro: whether to capture is decided at run
+ * time (see `StackTraceHooks`), so translation units and shared libraries
+ * built with and without it still agree on its layout and code.
  * -------------------------------------------------------------------------- */
-using Err = std::runtime_error;
+class Err : public std::runtime_error {
+public:
+  using std::runtime_error::runtime_error;
+
+  /** -------------------------------------------------------------------------
+   * @brief Constructs an error of the given \p kind.
+   * ------------------------------------------------------------------------ */
+  Err(char const* what, ErrKind kind) : std::runtime_error{what}, kind_(kind) { }
+
+  /** -------------------------------------------------------------------------
+   * @brief The category of the error; `ErrKind::kFailure` unless set.
+   * ------------------------------------------------------------------------ */
+  ErrKind kind() const noexcept { return kind_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief The context frames attached to this error, newest first.
+   * ------------------------------------------------------------------------ */
+  ContextChain const& context() const noexcept { return context_; }
+  ContextChain& context() noexcept { return context_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Where the error was created, or nullptr if unknown.
+   * ------------------------------------------------------------------------ */
+  ErrorSite const* origin() const noexcept { return origin_; }
+
+  void set_origin(ErrorSite const& site) noexcept { origin_ = &site; }
+
+  /** -------------------------------------------------------------------------
+   * @brief The stack at the creation of the error, or nullptr when stack
+   * traces are off. Include `StackTrace.h` to inspect it.
+   * ------------------------------------------------------------------------ */
+  StackTrace const* stack_trace() const noexcept {
+    return trace_.get();
+  }
+
+private:
+  ContextChain context_{};
+  ErrorSite const* origin_ = nullptr;
+  ErrKind kind_ = ErrKind::kFailure;
+  StackTraceRef trace_{};
+};
 
 /** ---------------------------------------------------------------------------
  * @brief Represents a value that can be either a successful value of type T
@@ -62,6 +152,43 @@ using Err = std::runtime_error;
 template <typename T>
 using Either = std::variant<T, Err>;
 
+/** ---------------------------------------------------------------------------
+ * @brief The error \c mbind propagates for an \c Either left valueless by an
+ * exception, which holds neither a value nor an error of its own.
+ *
+ * Created on first use; like any \c Err it allocates its message, so
+ * running out of memory right then ends the program instead of throwing
+ * out of a noexcept bind.
+ * -------------------------------------------------------------------------- */
+inline const Err& valueless_error() noexcept {
+  static const Err err{"Either is valueless by exception"};
+  return err;
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief A literal error type, for `Either` chains evaluated at compile time.
+ *
+ * `Err` derives from `std::runtime_error` and can't appear in constant
+ * expressions. A `LiteralErr` only refers to a static message, so chains of
+ * `LiteralEither` can run in `static_assert` or initialize constexpr tables.
+ * -------------------------------------------------------------------------- */
+class LiteralErr {
+public:
+  constexpr explicit LiteralErr(char const* what) noexcept : what_(what) { }
+
+  constexpr char const* what() const noexcept { return what_; }
+
+private:
+  char const* what_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief An `Either` whose error is a `LiteralErr`; a literal type for
+ * literal \p T.
+ * -------------------------------------------------------------------------- */
+template <typename T>
+using LiteralEither = std::variant<T, LiteralErr>;
+
 /** ---------------------------------------------------------------------------
  * @brief Functor to check if an Either variant holds the successful (right)
  * value of type T.
@@ -79,7 +206,7 @@ struct IsRight {
    * @param t A constant reference to the successful value.
    * @return true, indicating the Either holds a successful value.
    * ------------------------------------------------------------------------ */
-  bool operator()(const T& t) const {
+  bool operator()(const T& t) const noexcept {
     return true;
   }
 
@@ -88,7 +215,7 @@ struct IsRight {
    * @param err A constant reference to the error value.
    * @return false, indicating the Either does not hold a successful value.
    * ------------------------------------------------------------------------ */
-  bool operator()(const Err& err) const {
+  bool operator()(const Err& err) const noexcept {
     return false;
   }
 };
@@ -111,7 +238,7 @@ struct IsLeft {
    * @param t A constant reference to the successful value.
    * @return false, indicating the Either holds a successful value.
    * ------------------------------------------------------------------------ */
-  bool operator()(const T& t) const {
+  bool operator()(const T& t) const noexcept {
     return false;
   }
 
@@ -120,11 +247,48 @@ struct IsLeft {
    * @param err A constant reference to the error value.
    * @return true, indicating the Either does not hold a successful value.
    * ------------------------------------------------------------------------ */
-  bool operator()(const Err& err) const {
+  bool operator()(const Err& err) const noexcept {
     return true;
   }
 };
 
+/** ---------------------------------------------------------------------------
+ * @brief Checks whether an \c Either holds a successful value.
+ * -------------------------------------------------------------------------- */
+template <typename T>
+constexpr bool has_succeeded(const Either<T>& e) noexcept {
+  return 0 == e.index();
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Propagates the error \p err into an \c Either of type \p R.
+ *
+ * Builds defining \c MAYBE_EITHER_COMPACT_ERRORS keep this out of line and
+ * in the cold text section. Every \c mbind with the same result type then
+ * shares one copy of the error propagation instead of inlining its own, and
+ * only the success path is inlined per instantiation.
+ *
+ * The macro changes this inline function and so every \c mbind calling it.
+ * All translation units of a program, including shared libraries, must
+ * agree on it: mixing them violates the one definition rule and the linker
+ * keeps whichever copy it sees first. Define it for the whole build, as the
+ * \c ENABLE_COMPACT_ERRORS CMake option does, never per file.
+ *
+ * @tparam R The successful value type of the resulting Either.
+ * @param err The error to propagate.
+ * @return An \c Either of type \p R holding a copy of \p err.
+ * -------------------------------------------------------------------------- */
+template <typename R>
+#if defined(MAYBE_EITHER_COMPACT_ERRORS) && defined(__GNUC__)
+__attribute__((noinline, cold))
+#elif defined(MAYBE_EITHER_COMPACT_ERRORS) && defined(_MSC_VER)
+__declspec(noinline)
+#endif
+Either<R> propagate_error(const Err& err)
+  noexcept(std::is_nothrow_copy_constructible_v<Err>) {
+  return Either<R>(std::in_place_index<1>, err);
+}
+
 /** ---------------------------------------------------------------------------
  * @brief Monadic bind operation for the Either monad.
  *
@@ -148,6 +312,11 @@ struct IsLeft {
  * @note This implementation expects the function \p f to return an \c Either
  * to maintain the monadic chain. The successful type \p R is deduced from the
  * return type of \p f.
+ *
+ * @note The bind is noexcept when invoking \p f, building the \c Either<R>
+ * from its result and copying the error can't throw. A valueless \p e
+ * propagates \c valueless_error() rather than throwing
+ * \c std::bad_variant_access.
  * -------------------------------------------------------------------------- */
 template <
   typename T,
@@ -156,15 +325,23 @@ template <
     = typename std::variant_alternative_t<0, std::invoke_result_t<F, T>>
 >
 auto mbind(const Either<T>& e, F f)
+  noexcept(
+    std::is_nothrow_invocable_r_v<Either<R>, F&, const T&>
+      && std::is_nothrow_copy_constructible_v<Err>
+  )
   -> Either<R> {
-  // Check if the Either holds an error (is left).
-  if (std::visit(IsLeft<T>(), e)) {
+  // The alternatives are read through get_if, so no bad_variant_access can
+  // escape the noexcept bind, not even for a valueless Either. Compact
+  // builds propagate the error out of line.
+  if (ON_ERROR_PATH(0 != e.index())) {
     // If it's an error, propagate the error by wrapping it in an Either<R>.
-    return Either<R>(std::get<Err>(e));
+    return propagate_error<R>(
+      1 == e.index() ? *std::get_if<1>(&e) : valueless_error()
+    );
   }
 
-  // with it, returning the resulting Either<R>.
-  return std::invoke(f, std::get<T>(e));
+  // Otherwise apply f to the value, returning the resulting Either<R>.
+  return std::invoke(f, *std::get_if<0>(&e));
 }
 
 /** ---------------------------------------------------------------------------
@@ -183,14 +360,63 @@ auto mbind(const Either<T>& e, F f)
  * @return The result of the \c mbind operation: \c Either<U>.
  *
  * @note This operator uses perfect forwarding to handle both lvalue and rvalue
- * \c Either objects and functions efficiently.
+ * \c Either objects and functions efficiently. It is noexcept when the bind
+ * and passing \p f to it are.
  * -------------------------------------------------------------------------- */
 template <typename T, typename F>
-auto operator|(Either<T>&& e, F&& f) {
+auto operator|(Either<T>&& e, F&& f)
+  noexcept(noexcept(mbind<T, F>(std::move(e), std::forward<F>(f)))) {
   // Forward the Either and the function to the mbind function. The return
   // type of mbind will deduce the 'R' in its signature.
   using R = typename std::variant_alternative_t<0, std::invoke_result_t<F, T>>;
   return mbind<T, F>(std::forward<Either<T>>(e), std::forward<F>(f));
 }
 
+/** ---------------------------------------------------------------------------
+ * @brief Monadic bind operation for `LiteralEither`.
+ *
+ * Behaves as the `Either` bind, including when it is noexcept; for literal
+ * payloads and constexpr functions it is a constant expression.
+ *
+ * @code
+ * constexpr LiteralEither<int> port(int p) {
+ *   if (0 >= p || 65535 < p) {
+ *     return LiteralErr{"Port out of range"};
+ *   }
+ *   return p;
+ * }
+ *
+ * static_assert(0 == (LiteralEither<int>{8080} | port).index());
+ * @endcode
+ * -------------------------------------------------------------------------- */
+template <
+  typename T,
+  typename F,
+  typename R
+    = typename std::variant_alternative_t<0, std::invoke_result_t<F, T>>
+>
+constexpr auto mbind(const LiteralEither<T>& e, F f)
+  noexcept(std::is_nothrow_invocable_r_v<LiteralEither<R>, F&, const T&>)
+  -> LiteralEither<R> {
+  if (ON_ERROR_PATH(0 != e.index())) {
+    return LiteralEither<R>(
+      std::in_place_index<1>,
+      1 == e.index()
+        ? *std::get_if<1>(&e)
+        : LiteralErr{"LiteralEither is valueless by exception"}
+    );
+  }
+
+  return constexpr_invoke(f, *std::get_if<0>(&e));
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Pipe operator for monadic bind on `LiteralEither`.
+ * -------------------------------------------------------------------------- */
+template <typename T, typename F>
+constexpr auto operator|(LiteralEither<T>&& e, F&& f)
+  noexcept(noexcept(mbind<T, F>(std::move(e), std::forward<F>(f)))) {
+  return mbind<T, F>(std::forward<LiteralEither<T>>(e), std::forward<F>(f));
+}
+
 // End of 'Either.h'
\ No newline at end of file
@@ -0,0 +1,72 @@
+// ============================================================================
+// Provides cheap numeric codes identifying error messages.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ErrorCode.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Cheap numeric code identifying an error message.
+ *
+ * Hashes the message a word at a time, so it costs a few nanoseconds for
+ * typical messages while telling different errors apart in the log.
+ * -------------------------------------------------------------------------- */
+inline std::uint32_t error_code(char const* message) noexcept {
+  std::size_t length = std::strlen(message);
+  std::uint64_t h = 0x9e3779b97f4a7c15ull ^ length;
+
+  std::size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    std::uint64_t word;
+    std::memcpy(&word, message + i, 8);
+    h = (h ^ word) * 0xff51afd7ed558ccdull;
+    h ^= h >> 32;
+  }
+  if (i < length) {
+    std::uint64_t word = 0;
+    std::memcpy(&word, message + i, length - i);
+    h = (h ^ word) * 0xc4ceb9fe1a85ec53ull;
+  }
+
+  return static_cast<std::uint32_t>(h ^ (h >> 32));
+}
+
+// End of 'ErrorCode.h'
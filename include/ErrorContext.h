@@ -0,0 +1,173 @@
+// ============================================================================
+// Provides lazily formatted context breadcrumbs for Either errors.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ErrorContext.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "ContextFrame.h"
+#include "Either.h"
+#include "FramePool.h"
+
+// Standard library headers
+#include <new>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Context frame holding the arguments it is formatted from.
+ *
+ * Allocated from the calling thread's `FramePool`, so attaching context to a
+ * steady stream of errors does not touch the global heap. The text is the
+ * arguments streamed one after another.
+ *
+ * @tparam Args The decayed argument types; a `char const*` is kept as a
+ * pointer, so it must outlive the error (string literals always do).
+ * -------------------------------------------------------------------------- */
+template <typename... Args>
+class ArgsContextFrame final : public ContextFrame {
+public:
+  /** -------------------------------------------------------------------------
+   * @brief Creates a frame on top of \p parent in pooled memory.
+   * ------------------------------------------------------------------------ */
+  static ContextFrame* create(ContextFrame* parent, std::tuple<Args...>&& args) {
+    void* memory = FramePool::allocate(sizeof(ArgsContextFrame));
+
+    return ::new (memory) ArgsContextFrame{parent, std::move(args)};
+  }
+
+  void format(std::ostream& out) const override {
+    std::apply([&out](auto const&... arg) { (out << ... << arg); }, args_);
+  }
+
+private:
+  ArgsContextFrame(ContextFrame* parent, std::tuple<Args...>&& args)
+    : ContextFrame{parent}, args_(std::move(args)) { }
+
+  void destroy() noexcept override {
+    this->~ArgsContextFrame();
+    FramePool::deallocate(this, sizeof(ArgsContextFrame));
+  }
+
+  std::tuple<Args...> args_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Pipeline stage attaching a context frame to a failed `Either`.
+ *
+ * Created with `context()`. Holds the arguments until the stage is applied;
+ * a successful `Either` passes through untouched.
+ * -------------------------------------------------------------------------- */
+template <typename... Args>
+struct ErrorContext {
+  std::tuple<Args...> args;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Describes what the pipeline was doing when a later error occurs.
+ *
+ * The arguments are stored as they are and streamed into text only when the
+ * error is formatted with `error_message()`.
+ *
+ * @code
+ * auto r = parse_field(record)
+ *   | check_range
+ *   | context("in record ", index);
+ * @endcode
+ * -------------------------------------------------------------------------- */
+template <typename... Args>
+auto context(Args&&... args) {
+  return ErrorContext<std::decay_t<Args>...>{{std::forward<Args>(args)...}};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Attaches the context held by \p c to \p err.
+ * -------------------------------------------------------------------------- */
+template <typename... Args>
+#if defined(__GNUC__)
+__attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+__declspec(noinline)
+#endif
+void add_context(Err& err, std::tuple<Args...>&& args) {
+  err.context().push([&args](ContextFrame* parent) {
+    return ArgsContextFrame<Args...>::create(parent, std::move(args));
+  });
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Pipe operator applying a `context()` stage to an `Either`.
+ *
+ * On success this is a single test of the variant index.
+ * -------------------------------------------------------------------------- */
+template <typename T, typename... Args>
+Either<T> operator|(Either<T>&& e, ErrorContext<Args...> c) {
+  if (ON_ERROR_PATH(0 != e.index())) {
+    add_context(std::get<Err>(e), std::move(c.args));
+  }
+
+  return std::move(e);
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Formats \p err with its context, outermost frame first.
+ *
+ * @return "while parsing header: in record 7: Odd number" for an error
+ * "Odd number" that received the context "in record 7" and then "while
+ * parsing header"; just `what()` when there is no context.
+ * -------------------------------------------------------------------------- */
+inline std::string error_message(Err const& err) {
+  if (err.context().empty()) {
+    return err.what();
+  }
+
+  std::ostringstream out{};
+  for (auto const* frame = err.context().head(); nullptr != frame;
+       frame = frame->parent()) {
+    frame->format(out);
+    out << ": ";
+  }
+  out << err.what();
+
+  return out.str();
+}
+
+// End of 'ErrorContext.h'
@@ -0,0 +1,540 @@
+// ============================================================================
+// Provides a low-overhead, asynchronously drained log of Either errors.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ErrorLog.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "CycleClock.h"
+#include "Either.h"
+#include "ErrorCode.h"
+#include "ErrorSite.h"
+
+// Standard library headers
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// Macro Definitions Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Logs the error \p e at this call site and evaluates to it.
+ *
+ * @code
+ * if (!valid) {
+ *   return LOG_ERROR(FailedToCreate{});
+ * }
+ * @endcode
+ * -------------------------------------------------------------------------- */
+#define LOG_ERROR(e) log_error(ERROR_SITE(), e)
+
+/** ---------------------------------------------------------------------------
+ * @brief Wraps an `Either` stage so the errors it returns are logged at this
+ * call site: `create_expensive_e(true) | LOGGED(transform_expensive_e)`.
+ * -------------------------------------------------------------------------- */
+#define LOGGED(...) logged_stage(ERROR_SITE(), __VA_ARGS__)
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Single-producer, single-consumer ring of error events.
+ *
+ * The owning thread pushes and the drain thread pops, so neither side
+ * locks. When the ring is full new events are counted as dropped rather
+ * than blocking the producer.
+ * -------------------------------------------------------------------------- */
+class ErrorRing {
+public:
+  static constexpr std::size_t kCapacity = 1u << 12;
+
+  /** -------------------------------------------------------------------------
+   * @brief Longest message prefix an event keeps.
+   * ------------------------------------------------------------------------ */
+  static constexpr std::size_t kMessageSize = 72;
+
+  /** -------------------------------------------------------------------------
+   * @brief A logged error. The message is only copied for sampled events,
+   * into the event itself, so logging never allocates.
+   * ------------------------------------------------------------------------ */
+  struct Event {
+    std::uint64_t ticks;
+    ErrorSite const* site;
+    std::uint32_t code;
+    std::uint8_t length;      // Bytes of message used
+    bool sampled;
+    bool truncated;
+    char message[kMessageSize];
+  };
+
+  explicit ErrorRing(std::size_t thread) : thread_(thread) { }
+
+  std::size_t thread() const noexcept { return thread_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Hands a drained ring on to the thread numbered \p thread.
+   * ------------------------------------------------------------------------ */
+  void reset(std::size_t thread) noexcept {
+    thread_ = thread;
+    dropped_.store(0, std::memory_order_relaxed);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Appends an event, copying up to `kMessageSize` bytes of
+   * \p message unless it is null.
+   * @return false if the ring was full and the event dropped.
+   * ------------------------------------------------------------------------ */
+  bool push(
+    std::uint64_t ticks,
+    ErrorSite const* site,
+    std::uint32_t code,
+    char const* message
+  ) noexcept {
+    std::uint64_t head = head_.load(std::memory_order_relaxed);
+
+    // Only look at the consumer's position when the ring seems full, so the
+    // producer doesn't keep pulling in the cache line the consumer writes.
+    if (kCapacity <= head - cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (kCapacity <= head - cached_tail_) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    }
+
+    Event& e = events_[head % kCapacity];
+    e.ticks = ticks;
+    e.site = site;
+    e.code = code;
+    e.sampled = nullptr != message;
+    e.length = 0;
+    if (e.sampled) {
+      while (kMessageSize > e.length && '\0' != message[e.length]) {
+        e.message[e.length] = message[e.length];
+        ++e.length;
+      }
+      e.truncated = '\0' != message[e.length];
+    }
+    head_.store(head + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Hands the oldest event to \p sink.
+   * @return false if the ring was empty.
+   * ------------------------------------------------------------------------ */
+  template <typename Sink>
+  bool pop(Sink&& sink) {
+    std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    sink(events_[tail % kCapacity]);
+    tail_.store(tail + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Throws away the events left in a ring nobody will drain.
+   * ------------------------------------------------------------------------ */
+  void discard() noexcept {
+    tail_.store(
+      head_.load(std::memory_order_acquire),
+      std::memory_order_relaxed
+    );
+    dropped_.store(0, std::memory_order_relaxed);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Takes the count of events dropped since the last call.
+   * ------------------------------------------------------------------------ */
+  std::uint64_t take_dropped() noexcept {
+    return dropped_.exchange(0, std::memory_order_relaxed);
+  }
+
+private:
+  std::size_t thread_;
+  alignas(64) std::atomic<std::uint64_t> head_{0};
+  std::uint64_t cached_tail_ = 0;
+  // The producer only counts drops once it has seen a full ring, after
+  // loading tail_ anyway, so dropped_ shares the consumer's line.
+  alignas(64) std::atomic<std::uint64_t> tail_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+  std::array<Event, kCapacity> events_{};
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Process-wide error event log.
+ *
+ * Logging an error stores its timestamp, call site and message code in the
+ * calling thread's ring; only every `sample_every`-th event per thread also
+ * copies the full message. A background thread drains the rings into the
+ * log file, so the logging thread never formats or writes anything. While
+ * the log is not started `log_error()` costs a single relaxed load.
+ *
+ * A thread gets a ring the first time it logs. When the thread exits, the
+ * drain thread writes out what is left in its ring and hands the ring to
+ * the next thread that logs, so threads that come and go don't pile up
+ * rings. A thread exiting while the log is stopped hands its ring on at
+ * once, dropping anything it logged after the log stopped.
+ * -------------------------------------------------------------------------- */
+class ErrorLog {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  static ErrorLog& instance() {
+    static ErrorLog log{};
+    return log;
+  }
+
+  ErrorLog(ErrorLog const&) = delete;
+  ErrorLog& operator=(ErrorLog const&) = delete;
+
+  ~ErrorLog() {
+    stop();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Starts logging to the file at \p path.
+   *
+   * @param path The log file; it is truncated.
+   * @param sample_every Copy the message of one in this many events per
+   * thread; 1 keeps every message.
+   * @param interval How often the drain thread empties the rings.
+   * @return false if the log is already running or the file can't be opened.
+   * ------------------------------------------------------------------------ */
+  bool start(
+    std::string const& path,
+    std::uint32_t sample_every = 64,
+    Clock::duration interval = std::chrono::milliseconds{10}
+  ) {
+    std::lock_guard<std::mutex> lock{control_};
+    if (drain_.joinable()) {
+      return false;
+    }
+
+    file_ = std::fopen(path.c_str(), "w");
+    if (nullptr == file_) {
+      return false;
+    }
+
+    sample_every_.store(
+      0 == sample_every ? 1 : sample_every,
+      std::memory_order_relaxed
+    );
+    start_ticks_ = CycleClock::now();
+    {
+      std::lock_guard<std::mutex> wake{mutex_};
+      stopping_ = false;
+      draining_ = true;
+    }
+    drain_ = std::thread{[this, interval] { drain_loop(interval); }};
+    enabled_.store(true, std::memory_order_release);
+
+    return true;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Stops logging, writing out every event logged so far.
+   * ------------------------------------------------------------------------ */
+  void stop() {
+    std::lock_guard<std::mutex> lock{control_};
+    if (!drain_.joinable()) {
+      return;
+    }
+
+    enabled_.store(false, std::memory_order_relaxed);
+    {
+      std::lock_guard<std::mutex> wake{mutex_};
+      stopping_ = true;
+    }
+    wakeup_.notify_one();
+    drain_.join();
+
+    std::fclose(file_);
+    file_ = nullptr;
+  }
+
+  bool enabled() const noexcept {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Number of rings allocated so far, at most the number of threads
+   * that logged at the same time plus those not drained yet.
+   * ------------------------------------------------------------------------ */
+  std::size_t ring_count() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return rings_.size() + exited_.size() + idle_.size();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Logs \p message at \p site on the calling thread.
+   * ------------------------------------------------------------------------ */
+  void log(ErrorSite const& site, char const* message) {
+    thread_local RingLease local{};
+
+    if (nullptr == local.ring) {
+      local.ring = acquire_ring();
+    }
+
+    char const* sampled = nullptr;
+    if (0 == local.countdown) {
+      local.countdown = sample_every_.load(std::memory_order_relaxed);
+      sampled = message;
+    }
+    --local.countdown;
+
+    local.ring->push(CycleClock::now(), &site, error_code(message), sampled);
+  }
+
+private:
+  // Gives the ring of a thread back when the thread exits.
+  struct RingLease {
+    ErrorRing* ring = nullptr;
+    std::uint32_t countdown = 0;
+
+    ~RingLease() {
+      if (nullptr != ring) {
+        ErrorLog::instance().release_ring(ring);
+      }
+    }
+  };
+
+  ErrorLog() = default;
+
+  ErrorRing* acquire_ring() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    ++threads_;
+    if (!idle_.empty()) {
+      auto ring = std::move(idle_.back());
+      idle_.pop_back();
+      ring->reset(threads_);
+      rings_.push_back(std::move(ring));
+    } else {
+      rings_.push_back(std::make_unique<ErrorRing>(threads_));
+    }
+
+    return rings_.back().get();
+  }
+
+  // The ring keeps its events until the drain thread has written them out;
+  // with no drain thread left to do so it can be handed on right away.
+  void release_ring(ErrorRing* ring) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    auto it = std::find_if(
+      rings_.begin(),
+      rings_.end(),
+      [ring](auto const& r) { return r.get() == ring; }
+    );
+    if (draining_) {
+      exited_.push_back(std::move(*it));
+    } else {
+      ring->discard();
+      idle_.push_back(std::move(*it));
+    }
+    rings_.erase(it);
+  }
+
+  void drain_loop(Clock::duration interval) {
+    double ns_per_tick = CycleClock::ns_per_tick();
+    std::unique_lock<std::mutex> lock{mutex_};
+
+    while (true) {
+      bool last = wakeup_.wait_for(lock, interval, [this] { return stopping_; });
+
+      // Only this thread frees rings or hands them on, so the ones seen
+      // here can be drained without holding the lock. The rings of exited
+      // threads get no more events; once drained they can be reused.
+      std::vector<ErrorRing*> rings{};
+      for (auto const& ring : rings_) {
+        rings.push_back(ring.get());
+      }
+      auto exited = std::move(exited_);
+      exited_.clear();
+      lock.unlock();
+      for (auto* ring : rings) {
+        drain(*ring, ns_per_tick);
+      }
+      for (auto& ring : exited) {
+        drain(*ring, ns_per_tick);
+      }
+      std::fflush(file_);
+      lock.lock();
+      for (auto& ring : exited) {
+        idle_.push_back(std::move(ring));
+      }
+
+      if (last) {
+        // Threads that exited during this pass were drained with the live
+        // ones; from now on release_ring() hands rings on by itself.
+        for (auto& ring : exited_) {
+          ring->discard();
+          idle_.push_back(std::move(ring));
+        }
+        exited_.clear();
+        draining_ = false;
+        break;
+      }
+    }
+  }
+
+  void drain(ErrorRing& ring, double ns_per_tick) {
+    while (ring.pop([&](ErrorRing::Event const& e) {
+      double ns = e.ticks > start_ticks_
+        ? static_cast<double>(e.ticks - start_ticks_) * ns_per_tick
+        : 0.0;
+
+      std::fprintf(
+        file_,
+        "%.0f thread=%zu %s:%d code=%08x",
+        ns,
+        ring.thread(),
+        e.site->file,
+        e.site->line,
+        static_cast<unsigned>(e.code)
+      );
+      if (e.sampled) {
+        std::fprintf(
+          file_,
+          " message=\"%.*s%s\"",
+          static_cast<int>(e.length),
+          e.message,
+          e.truncated ? "..." : ""
+        );
+      }
+      std::fputc('\n', file_);
+    })) { }
+
+    if (auto dropped = ring.take_dropped()) {
+      std::fprintf(
+        file_,
+        "thread=%zu dropped=%llu\n",
+        ring.thread(),
+        static_cast<unsigned long long>(dropped)
+      );
+    }
+  }
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<std::uint32_t> sample_every_{64};
+  std::uint64_t start_ticks_ = 0;
+  std::FILE* file_ = nullptr;
+
+  std::mutex control_;
+  mutable std::mutex mutex_;
+  std::condition_variable wakeup_;
+  bool stopping_ = false;
+  bool draining_ = false;
+  std::thread drain_;
+  std::size_t threads_ = 0;
+  std::vector<std::unique_ptr<ErrorRing>> rings_;
+  std::vector<std::unique_ptr<ErrorRing>> exited_;
+  std::vector<std::unique_ptr<ErrorRing>> idle_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Logs \p e at \p site if the error log is running.
+ *
+ * Mutable errors without a known origin get \p site as their origin.
+ *
+ * @return \p e, so the call can wrap the expression creating the error: a
+ * reference to an lvalue, a moved copy of a temporary, which would be gone
+ * by the end of the full expression.
+ * -------------------------------------------------------------------------- */
+template <typename E>
+std::conditional_t<std::is_lvalue_reference_v<E>, E, std::decay_t<E>>
+log_error(ErrorSite const& site, E&& e) {
+  if constexpr (!std::is_const_v<std::remove_reference_t<E>>) {
+    if (nullptr == e.origin()) {
+      e.set_origin(site);
+    }
+  }
+
+  auto& log = ErrorLog::instance();
+  if (log.enabled()) {
+    log.log(site, e.what());
+  }
+
+  return std::forward<E>(e);
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief An `Either` stage whose errors are logged at a call site; created
+ * by `LOGGED`.
+ * -------------------------------------------------------------------------- */
+template <typename F>
+class LoggedStage {
+public:
+  LoggedStage(ErrorSite const& site, F f) : site_(&site), f_(std::move(f)) { }
+
+  template <typename T>
+  auto operator()(T&& value) const {
+    auto r = std::invoke(f_, std::forward<T>(value));
+    if (ON_ERROR_PATH(0 != r.index())) {
+      log_error(*site_, std::get<1>(r));
+    }
+
+    return r;
+  }
+
+private:
+  ErrorSite const* site_;
+  F f_;
+};
+
+template <typename F>
+auto logged_stage(ErrorSite const& site, F&& f) {
+  return LoggedStage<std::decay_t<F>>{site, std::forward<F>(f)};
+}
+
+// End of 'ErrorLog.h'
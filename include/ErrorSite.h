@@ -0,0 +1,160 @@
+// ============================================================================
+// Provides static call-site records for errors and their resolution.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ErrorSite.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// ============================================================================
+// Macro Definitions Section
+// ============================================================================
+
+#if defined(__GNUC__)
+#define ERROR_SITE_FUNCTION __PRETTY_FUNCTION__
+#elif defined(_MSC_VER)
+#define ERROR_SITE_FUNCTION __FUNCSIG__
+#else
+#define ERROR_SITE_FUNCTION __func__
+#endif
+
+/** ---------------------------------------------------------------------------
+ * @brief Static record of the call site of the enclosing macro expansion.
+ *
+ * The record is a compile-time constant, so taking it costs nothing at run
+ * time and its address identifies the call site.
+ * -------------------------------------------------------------------------- */
+#define ERROR_SITE()                                                         \
+  ([]() -> ErrorSite const& {                                                \
+    static constexpr ErrorSite site{__FILE__, __LINE__, ERROR_SITE_FUNCTION};\
+    return site;                                                             \
+  }())
+
+/** ---------------------------------------------------------------------------
+ * @brief Records this call site as the origin of the error \p e and
+ * evaluates to it.
+ *
+ * @code
+ * if (!valid) {
+ *   return MAKE_ERROR(FailedToCreate{});
+ * }
+ * @endcode
+ * -------------------------------------------------------------------------- */
+#define MAKE_ERROR(e) with_origin(ERROR_SITE(), e)
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Source location an error was created or logged at.
+ *
+ * `function` is the signature of the lambda `ERROR_SITE()` expands to, i.e.
+ * the enclosing function wrapped in the compiler's lambda decoration;
+ * `site_function()` strips the decoration.
+ * -------------------------------------------------------------------------- */
+struct ErrorSite {
+  char const* file;
+  int line;
+  char const* function;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief The signature of the function containing \p site.
+ *
+ * Strips the lambda decoration each compiler adds around the enclosing
+ * function:
+ *
+ * - GCC: `f(int)::<lambda()>`;
+ * - clang: `const ErrorSite &f(int)::(lambda at file:line:col)::operator()()
+ *   const`;
+ * - MSVC: `const struct ErrorSite &__cdecl f::<lambda_1>::operator ()(void)
+ *   const`, which leaves out the parameters of `f`.
+ * -------------------------------------------------------------------------- */
+inline std::string site_function(ErrorSite const& site) {
+  std::string function{site.function};
+
+  for (char const* lambda : {
+    "::<lambda",
+    "::(lambda at ",
+    "::(anonymous class)"
+  }) {
+    auto suffix = function.find(lambda);
+    if (std::string::npos != suffix) {
+      function.erase(suffix);
+    }
+  }
+
+  // The return type of the lambda, which clang and MSVC print first.
+  static constexpr char kReturnType[] = "ErrorSite &";
+  auto return_type = function.find(kReturnType);
+  if (0 == function.rfind("const ", 0) && std::string::npos != return_type) {
+    function.erase(0, return_type + sizeof kReturnType - 1);
+  }
+
+  static constexpr char kCallingConvention[] = "__cdecl ";
+  if (0 == function.rfind(kCallingConvention, 0)) {
+    function.erase(0, sizeof kCallingConvention - 1);
+  }
+
+  return function;
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Formats \p site as "file:line in function".
+ * -------------------------------------------------------------------------- */
+inline std::string describe_site(ErrorSite const& site) {
+  return std::string{site.file} + ":" + std::to_string(site.line) + " in "
+    + site_function(site);
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Sets \p site as the origin of the error \p e.
+ * @return \p e, so the call can wrap the expression creating the error: a
+ * reference to an lvalue, a moved copy of a temporary.
+ * -------------------------------------------------------------------------- */
+template <typename E>
+std::conditional_t<std::is_lvalue_reference_v<E>, E, std::decay_t<E>>
+with_origin(ErrorSite const& site, E&& e) noexcept(
+  std::is_lvalue_reference_v<E>
+    || std::is_nothrow_move_constructible_v<std::decay_t<E>>
+) {
+  e.set_origin(site);
+  return std::forward<E>(e);
+}
+
+// End of 'ErrorSite.h'
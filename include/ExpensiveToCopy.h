@@ -36,7 +36,9 @@
 
 // Project headers
 #include "Either.h"
+#include "ErrorContext.h"
 #include "Maybe.h"
+#include "StackTrace.h"
 
 // Standard library headers
 #include <iostream>
@@ -165,10 +167,15 @@ template <typename T>
 struct PrintResult {
   /** -------------------------------------------------------------------------
    * @brief Overload for visiting the error (Err) state of an Either.
+   * Prints the error preceded by any context attached to it, followed by
+   * its symbolized stack trace in builds that capture them.
    * @param err The constant reference to the error object.
    * ------------------------------------------------------------------------ */
   void operator()(const Err& err) {
-    std::cout << err.what() << "\n";
+    std::cout << error_message(err) << "\n";
+    if (nullptr != err.stack_trace()) {
+      std::cout << err.stack_trace()->format();
+    }
   }
 
   /** -------------------------------------------------------------------------
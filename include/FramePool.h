@@ -0,0 +1,194 @@
+// ============================================================================
+// Provides a per-thread recycling pool for small, short-lived allocations.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FramePool.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <array>
+#include <cstddef>
+#include <new>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Per-thread recycling pool of fixed size-class memory blocks.
+ *
+ * Requests up to `kMaxBlockSize` bytes are rounded up to a multiple of
+ * `kGranularity` and served from a thread-local free list for that size
+ * class. Released blocks are pushed back onto the free list of the releasing
+ * thread, so a steady stream of same-sized allocations (coroutine frames,
+ * error context frames, ...) stops touching the global heap after warmup.
+ * Larger requests, and blocks released while a free list is already full,
+ * fall through to the global `operator new`/`operator delete`.
+ *
+ * Once the pool of a thread has been destroyed at thread exit, blocks that
+ * thread still allocates or releases (e.g. from other thread-local or static
+ * destructors) go straight to the global heap.
+ *
+ * @note Callers must pass the same \p size to `deallocate()` that was passed
+ * to `allocate()`, as the pool keeps no per-block header.
+ * -------------------------------------------------------------------------- */
+class FramePool {
+public:
+  /** -------------------------------------------------------------------------
+   * @brief Size class granularity in bytes.
+   * ------------------------------------------------------------------------ */
+  static constexpr std::size_t kGranularity = 64;
+
+  /** -------------------------------------------------------------------------
+   * @brief Largest request served from the pool.
+   * ------------------------------------------------------------------------ */
+  static constexpr std::size_t kMaxBlockSize = 1024;
+
+  /** -------------------------------------------------------------------------
+   * @brief Upper bound on the number of idle blocks cached per size class.
+   * ------------------------------------------------------------------------ */
+  static constexpr std::size_t kMaxCachedBlocks = 64;
+
+  /** -------------------------------------------------------------------------
+   * @brief Allocates a block of at least \p size bytes.
+   * @param size Requested block size in bytes.
+   * @return Pointer to a block suitably aligned for any fundamental type.
+   * ------------------------------------------------------------------------ */
+  static void* allocate(std::size_t size) {
+    if (size > kMaxBlockSize || destroyed()) {
+      return ::operator new(size);
+    }
+
+    FreeList& list = local().lists_[size_class(size)];
+    if (nullptr != list.head) {
+      Node* node = list.head;
+      list.head = node->next;
+      --list.cached;
+
+      return node;
+    }
+
+    return ::operator new(block_size(size));
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Returns a block obtained from `allocate()` to the pool.
+   * @param ptr Pointer returned by `allocate()`.
+   * @param size The size that was passed to `allocate()`.
+   * ------------------------------------------------------------------------ */
+  static void deallocate(void* ptr, std::size_t size) noexcept {
+    if (size > kMaxBlockSize || destroyed()) {
+      ::operator delete(ptr);
+      return;
+    }
+
+    FreeList& list = local().lists_[size_class(size)];
+    if (list.cached >= kMaxCachedBlocks) {
+      ::operator delete(ptr);
+      return;
+    }
+
+    Node* node = static_cast<Node*>(ptr);
+    node->next = list.head;
+    list.head = node;
+    ++list.cached;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Number of idle blocks the calling thread holds for \p size.
+   * @param size A request size in bytes.
+   * @return The number of cached blocks in the matching size class, or zero
+   * for sizes not served from the pool.
+   * ------------------------------------------------------------------------ */
+  static std::size_t cached(std::size_t size) noexcept {
+    if (size > kMaxBlockSize || destroyed()) {
+      return 0;
+    }
+
+    return local().lists_[size_class(size)].cached;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Releases cached blocks back to the global heap on thread exit.
+   * ------------------------------------------------------------------------ */
+  ~FramePool() {
+    destroyed() = true;
+
+    for (auto& list : lists_) {
+      while (nullptr != list.head) {
+        Node* next = list.head->next;
+        ::operator delete(list.head);
+        list.head = next;
+      }
+    }
+  }
+
+private:
+  struct Node {
+    Node* next;
+  };
+
+  struct FreeList {
+    Node* head = nullptr;
+    std::size_t cached = 0;
+  };
+
+  static constexpr std::size_t kClassCount = kMaxBlockSize / kGranularity;
+
+  static constexpr std::size_t size_class(std::size_t size) noexcept {
+    return 0 == size ? 0 : (size - 1) / kGranularity;
+  }
+
+  static constexpr std::size_t block_size(std::size_t size) noexcept {
+    return (size_class(size) + 1) * kGranularity;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Set once the calling thread's pool has been destroyed.
+   *
+   * Trivially destructible, so it stays readable for the rest of the thread
+   * exit, after `local()` has gone.
+   * ------------------------------------------------------------------------ */
+  static bool& destroyed() noexcept {
+    thread_local bool flag = false;
+    return flag;
+  }
+
+  static FramePool& local() noexcept {
+    thread_local FramePool pool;
+    return pool;
+  }
+
+  std::array<FreeList, kClassCount> lists_{};
+};
+
+// End of 'FramePool.h'
@@ -0,0 +1,141 @@
+// ============================================================================
+// Provides per-thread hardware event counters such as branch misses.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * HardwareCounters.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Counts a hardware event of the calling thread in user space.
+ *
+ * Backed by perf_event_open() on Linux. Where the event can't be opened
+ * (other systems, virtual machines without a PMU, a restrictive
+ * perf_event_paranoid) the counter is invalid and reads zero.
+ * -------------------------------------------------------------------------- */
+class HardwareCounter {
+public:
+  /** -------------------------------------------------------------------------
+   * @brief Counts mispredicted branches.
+   * ------------------------------------------------------------------------ */
+  static HardwareCounter branch_misses() {
+#if defined(__linux__)
+    return HardwareCounter{PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES};
+#else
+    return HardwareCounter{};
+#endif
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Counts retired branch instructions.
+   * ------------------------------------------------------------------------ */
+  static HardwareCounter branches() {
+#if defined(__linux__)
+    return HardwareCounter{
+      PERF_TYPE_HARDWARE,
+      PERF_COUNT_HW_BRANCH_INSTRUCTIONS
+    };
+#else
+    return HardwareCounter{};
+#endif
+  }
+
+  HardwareCounter() noexcept = default;
+
+  HardwareCounter(std::uint32_t type, std::uint64_t config) noexcept {
+#if defined(__linux__)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+    static_cast<void>(type);
+    static_cast<void>(config);
+#endif
+  }
+
+  HardwareCounter(HardwareCounter&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1)) { }
+
+  HardwareCounter& operator=(HardwareCounter&& other) noexcept {
+    std::swap(fd_, other.fd_);
+    return *this;
+  }
+
+  ~HardwareCounter() {
+#if defined(__linux__)
+    if (valid()) {
+      close(fd_);
+    }
+#endif
+  }
+
+  bool valid() const noexcept { return 0 <= fd_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Events counted since the counter was opened.
+   * ------------------------------------------------------------------------ */
+  std::uint64_t read() const noexcept {
+    std::uint64_t count = 0;
+#if defined(__linux__)
+    if (valid() && sizeof(count) != ::read(fd_, &count, sizeof(count))) {
+      count = 0;
+    }
+#endif
+
+    return count;
+  }
+
+private:
+  int fd_ = -1;
+};
+
+// End of 'HardwareCounters.h'
@@ -0,0 +1,441 @@
+// ============================================================================
+// Provides per-stage latency histograms for monadic pipelines.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * LatencyHistogram.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "CycleClock.h"
+#include "Either.h"
+#include "Maybe.h"
+#include "StageHooks.h"
+
+// Standard library headers
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Log-bucketed histogram of tick counts.
+ *
+ * Values below 8 get a bucket each; above that every power of two is split
+ * into 8 linear sub-buckets, so a bucket is never wider than 12.5% of the
+ * values it holds. Buckets are relaxed atomics so snapshots may read them
+ * while the owning thread records.
+ * -------------------------------------------------------------------------- */
+class LogHistogram {
+public:
+  static constexpr std::size_t kSubBucketBits = 3;
+  static constexpr std::size_t kSubBuckets = 1u << kSubBucketBits;
+  static constexpr std::size_t kBuckets
+    = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+  /** -------------------------------------------------------------------------
+   * @brief The bucket holding \p value.
+   * ------------------------------------------------------------------------ */
+  static std::size_t bucket_of(std::uint64_t value) noexcept {
+    if (value < kSubBuckets) {
+      return static_cast<std::size_t>(value);
+    }
+
+    std::size_t shift = floor_log2(value) - kSubBucketBits;
+
+    return (shift + 1) * kSubBuckets
+      + static_cast<std::size_t>((value >> shift) & (kSubBuckets - 1));
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief The smallest value falling into \p bucket.
+   * ------------------------------------------------------------------------ */
+  static std::uint64_t lower_bound(std::size_t bucket) noexcept {
+    if (bucket < kSubBuckets) {
+      return bucket;
+    }
+
+    std::size_t shift = bucket / kSubBuckets - 1;
+
+    return (kSubBuckets + bucket % kSubBuckets) << shift;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief The value reported for \p bucket: the middle of its range.
+   * ------------------------------------------------------------------------ */
+  static double midpoint(std::size_t bucket) noexcept {
+    if (bucket < kSubBuckets) {
+      return static_cast<double>(bucket);
+    }
+
+    std::uint64_t width = std::uint64_t{1} << (bucket / kSubBuckets - 1);
+
+    return static_cast<double>(lower_bound(bucket)) + (width - 1) / 2.0;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Records \p value; only one thread may record at a time.
+   * ------------------------------------------------------------------------ */
+  void record(std::uint64_t value) noexcept {
+    auto& bucket = buckets_[bucket_of(value)];
+    bucket.store(
+      bucket.load(std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed
+    );
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Records \p value; safe for any number of concurrent threads.
+   * ------------------------------------------------------------------------ */
+  void record_shared(std::uint64_t value) noexcept {
+    buckets_[bucket_of(value)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  std::uint64_t count(std::size_t bucket) const noexcept {
+    return buckets_[bucket].load(std::memory_order_relaxed);
+  }
+
+private:
+  static std::size_t floor_log2(std::uint64_t value) noexcept {
+#if defined(__GNUC__)
+    return 63 - static_cast<std::size_t>(__builtin_clzll(value));
+#else
+    std::size_t log = 0;
+    while (value >>= 1) {
+      ++log;
+    }
+
+    return log;
+#endif
+  }
+
+  std::array<std::atomic<std::uint64_t>, kBuckets> buckets_{};
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Merged latency of one pipeline stage, in nanoseconds.
+ * -------------------------------------------------------------------------- */
+struct StageLatency {
+  std::string name;
+  std::uint64_t count;
+  double mean;
+  double p50;
+  double p99;
+  double p999;
+  double max;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Latency histograms of the stages of a pipeline.
+ *
+ * Stages are identified by their position in the pipeline. Each recording
+ * thread gets its own set of histograms, allocated on first use, so
+ * recording never locks and never contends with other threads. A thread
+ * hands its set on to the next thread when it exits, so only threads
+ * recording at the same time need sets of their own; beyond
+ * `kMaxThreads - 1` of them, the rest share the last set and record with
+ * atomic adds. `snapshot()` merges all sets.
+ * -------------------------------------------------------------------------- */
+class LatencyHistograms {
+public:
+  static constexpr std::size_t kMaxStages = 32;
+  static constexpr std::size_t kMaxThreads = 64;
+
+  /** -------------------------------------------------------------------------
+   * @brief Creates histograms for a pipeline; \p names label the stages in
+   * order, stages without a name are reported as "stage N".
+   * ------------------------------------------------------------------------ */
+  explicit LatencyHistograms(std::vector<std::string> names = {})
+    : names_(std::move(names)) { }
+
+  LatencyHistograms(LatencyHistograms const&) = delete;
+  LatencyHistograms& operator=(LatencyHistograms const&) = delete;
+
+  ~LatencyHistograms() {
+    for (auto& shard : shards_) {
+      for (auto& h : shard) {
+        delete h.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Records that \p stage took \p ticks `CycleClock` ticks.
+   * ------------------------------------------------------------------------ */
+  void record(std::size_t stage, std::uint64_t ticks) {
+    if (kMaxStages <= stage) {
+      return;
+    }
+
+    std::size_t thread = thread_index();
+    bool shared = kMaxThreads - 1 <= thread;
+    std::size_t shard = shared ? kMaxThreads - 1 : thread;
+
+    LogHistogram* h = shards_[shard][stage].load(std::memory_order_acquire);
+    if (nullptr == h) {
+      h = allocate(shard, stage);
+    }
+
+    if (shared) {
+      h->record_shared(ticks);
+    } else {
+      h->record(ticks);
+    }
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Merges the histograms of all threads.
+   * @return The latency of every stage that has recorded at least once.
+   * ------------------------------------------------------------------------ */
+  std::vector<StageLatency> snapshot() const {
+    std::vector<StageLatency> result{};
+    double ns_per_tick = CycleClock::ns_per_tick();
+
+    for (std::size_t stage = 0; stage < kMaxStages; ++stage) {
+      std::array<std::uint64_t, LogHistogram::kBuckets> merged{};
+      std::uint64_t total = 0;
+
+      for (auto const& shard : shards_) {
+        LogHistogram const* h = shard[stage].load(std::memory_order_acquire);
+        if (nullptr == h) {
+          continue;
+        }
+
+        for (std::size_t b = 0; b < LogHistogram::kBuckets; ++b) {
+          merged[b] += h->count(b);
+          total += h->count(b);
+        }
+      }
+
+      if (0 == total) {
+        continue;
+      }
+
+      result.push_back(summarize(stage, merged, total, ns_per_tick));
+    }
+
+    return result;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief The set of histograms the calling thread records into;
+   * `kMaxThreads - 1` is the shared set.
+   * ------------------------------------------------------------------------ */
+  static std::size_t thread_index() noexcept {
+    thread_local ThreadSlot const slot{};
+    return slot.index();
+  }
+
+private:
+  using Shard = std::array<std::atomic<LogHistogram*>, kMaxStages>;
+
+  static_assert(64 >= kMaxThreads, "thread slots are tracked in 64 bits");
+
+  /** -------------------------------------------------------------------------
+   * @brief A private set index held by a thread until it exits.
+   *
+   * The slots are shared by every `LatencyHistograms`, as a thread uses the
+   * same index in all of them. Releasing a slot happens before it is
+   * claimed again, so a set still has a single writer at a time.
+   * ------------------------------------------------------------------------ */
+  class ThreadSlot {
+  public:
+    ThreadSlot() noexcept : index_(claim()) { }
+
+    ThreadSlot(ThreadSlot const&) = delete;
+    ThreadSlot& operator=(ThreadSlot const&) = delete;
+
+    ~ThreadSlot() {
+      if (kMaxThreads - 1 != index_) {
+        used().fetch_and(
+          ~(std::uint64_t{1} << index_),
+          std::memory_order_release
+        );
+      }
+    }
+
+    std::size_t index() const noexcept { return index_; }
+
+  private:
+    static std::atomic<std::uint64_t>& used() noexcept {
+      static std::atomic<std::uint64_t> slots{0};
+      return slots;
+    }
+
+    static std::size_t claim() noexcept {
+      auto& slots = used();
+      std::uint64_t current = slots.load(std::memory_order_relaxed);
+
+      for (;;) {
+        std::size_t index = 0;
+        while (kMaxThreads - 1 != index
+          && 0 != (current & (std::uint64_t{1} << index))) {
+          ++index;
+        }
+        if (kMaxThreads - 1 == index) {
+          return index;
+        }
+
+        if (slots.compare_exchange_weak(
+              current,
+              current | (std::uint64_t{1} << index),
+              std::memory_order_acquire,
+              std::memory_order_relaxed
+            )) {
+          return index;
+        }
+      }
+    }
+
+    std::size_t index_;
+  };
+
+
+  LogHistogram* allocate(std::size_t shard, std::size_t stage) {
+    auto* fresh = new LogHistogram{};
+    LogHistogram* expected = nullptr;
+
+    // Only the shared shard can race here.
+    if (!shards_[shard][stage].compare_exchange_strong(
+          expected,
+          fresh,
+          std::memory_order_acq_rel
+        )) {
+      delete fresh;
+      return expected;
+    }
+
+    return fresh;
+  }
+
+  StageLatency summarize(
+    std::size_t stage,
+    std::array<std::uint64_t, LogHistogram::kBuckets> const& merged,
+    std::uint64_t total,
+    double ns_per_tick
+  ) const {
+    StageLatency s{
+      stage < names_.size() && !names_[stage].empty()
+        ? names_[stage]
+        : "stage " + std::to_string(stage),
+      total,
+      0.0,
+      0.0,
+      0.0,
+      0.0,
+      0.0
+    };
+
+    std::array<std::pair<double, double*>, 3> quantiles{{
+      {0.5, &s.p50},
+      {0.99, &s.p99},
+      {0.999, &s.p999}
+    }};
+    std::size_t next = 0;
+    std::uint64_t seen = 0;
+    double sum = 0.0;
+
+    for (std::size_t b = 0; b < LogHistogram::kBuckets; ++b) {
+      if (0 == merged[b]) {
+        continue;
+      }
+
+      double value = LogHistogram::midpoint(b) * ns_per_tick;
+      seen += merged[b];
+      sum += value * merged[b];
+      s.max = value;
+
+      while (next < quantiles.size()
+        && seen >= quantiles[next].first * total) {
+        *quantiles[next].second = value;
+        ++next;
+      }
+    }
+    s.mean = sum / total;
+
+    return s;
+  }
+
+  std::vector<std::string> names_;
+  std::array<Shard, kMaxThreads> shards_{};
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Stage hook timing the stages that run into `LatencyHistograms`.
+ *
+ * Short-circuited stages are not recorded. The histograms must outlive the
+ * pipeline.
+ * -------------------------------------------------------------------------- */
+class LatencyHook : public StageHook {
+public:
+  explicit LatencyHook(LatencyHistograms& histograms) noexcept
+    : histograms_(&histograms) { }
+
+  template <typename Out, typename S, typename M, typename Next>
+  Out around(std::size_t index, S const&, M&, Next&& next) {
+    std::uint64_t start = CycleClock::now();
+    Out r = std::forward<Next>(next)();
+    histograms_->record(index, CycleClock::now() - start);
+
+    return r;
+  }
+
+private:
+  LatencyHistograms* histograms_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Times the stages of the pipeline \p value into \p histograms.
+ *
+ * @code
+ * LatencyHistograms latency{{"transform", "accumulate"}};
+ * auto r = (with_latency(create_expensive_e(true), latency)
+ *   | transform_expensive_e
+ *   | accumulate_expensive_e).result();
+ * @endcode
+ *
+ * @param value A `Maybe`/`Either`, or a pipeline started by another
+ * `with_*()` function.
+ * -------------------------------------------------------------------------- */
+template <typename M>
+auto with_latency(M&& value, LatencyHistograms& histograms) {
+  return attach_hook(std::forward<M>(value), LatencyHook{histograms});
+}
+
+// End of 'LatencyHistogram.h'
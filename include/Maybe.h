@@ -34,10 +34,15 @@
 // Headers Include Section
 // ============================================================================
 
+// Project headers
+#include "BranchHint.h"
+#include "ConstexprInvoke.h"
+
 // Standard library headers
 #include <functional>
 #include <optional>
 #include <stdexcept> // For std::runtime_error
+#include <type_traits>
 #include <utility>   // For std::forward
 
 // ============================================================================
@@ -57,6 +62,14 @@
 template <typename T>
 using Maybe = std::optional<T>;
 
+/** ---------------------------------------------------------------------------
+ * @brief Checks whether a `Maybe` holds a value.
+ * -------------------------------------------------------------------------- */
+template <typename T>
+constexpr bool has_succeeded(Maybe<T> const& mb) noexcept {
+  return mb.has_value();
+}
+
 /** ---------------------------------------------------------------------------
  * @brief Monadic bind operation for the `Maybe` type.
  *
@@ -86,15 +99,22 @@ using Maybe = std::optional<T>;
  * must return another `Maybe` (i.e., an `std::optional<U>`). Attempting to
  * chain a function that returns a raw value (`U` instead of `Maybe<U>`) will
  * result in a compilation error.
+ *
+ * @note For literal payloads and constexpr functions the bind is a constant
+ * expression, so whole chains can be evaluated at compile time. It is
+ * noexcept when invoking `f` and building the `Maybe<R>` from its result
+ * can't throw.
  * -------------------------------------------------------------------------- */
 template <
 	typename T,
 	typename F,
 	typename R = typename std::invoke_result_t<F, T>::value_type
 >
-auto mbind(const Maybe<T>& mb, F f) -> Maybe<R> {
-  if (mb) {
-    return std::invoke(f, mb.value());    
+constexpr auto mbind(const Maybe<T>& mb, F f)
+  noexcept(std::is_nothrow_invocable_r_v<Maybe<R>, F&, const T&>)
+  -> Maybe<R> {
+  if (ON_SUCCESS_PATH(mb)) {
+    return constexpr_invoke(f, *mb);    
   } else {
     return {};    
   }
@@ -118,10 +138,12 @@ auto mbind(const Maybe<T>& mb, F f) -> Maybe<R> {
  * specific type `U` is automatically deduced based on the return type of `f`.
  *
  * @note This operator uses perfect forwarding to handle both lvalue and rvalue
- * `Maybe` objects and functions efficiently.
+ * `Maybe` objects and functions efficiently. It is noexcept when the bind
+ * and passing `f` to it are.
  * -------------------------------------------------------------------------- */
 template <typename T, typename F>
-auto operator|(Maybe<T>&& e, F&& f) {
+constexpr auto operator|(Maybe<T>&& e, F&& f)
+  noexcept(noexcept(mbind<T, F>(std::move(e), std::forward<F>(f)))) {
   return mbind<T, F>(std::forward<Maybe<T>>(e), std::forward<F>(f));
 }
 
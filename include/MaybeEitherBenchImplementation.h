@@ -0,0 +1,106 @@
+// ============================================================================
+// Benchmark mode of the Maybe/Either demo app.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+// 
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+// 
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MaybeEitherBenchImplementation.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include <MaybeEitherCommon.h>
+#include <ProgramActions/BenchmarkAction.h>
+#include <ProgramActions/PerfWorkloads.h>
+
+// Standard library headers
+#include <cstddef>
+#include <string_view>
+
+// ============================================================================
+// Class Declaration Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Parameters of a benchmark run of the demo chains.
+ * -------------------------------------------------------------------------- */
+struct BenchConfig
+{
+    std::size_t iterations;     // Chains run per monad, over all threads
+    std::size_t threads;        // Threads running chains concurrently
+    std::size_t chain_length;   // Stages per chain
+    std::size_t payload_bytes;  // Size of the value passed between stages
+    double error_rate;          // Fraction of chains that fail at some stage
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Checks that a benchmark configuration describes a runnable
+ * benchmark: positive counts and an error rate within [0, 1].
+ * -------------------------------------------------------------------------- */
+bool valid_bench_config(BenchConfig const& config);
+
+/** ---------------------------------------------------------------------------
+ * @brief The Maybe and Either chains of the benchmark as single-threaded
+ * workloads, one chain per call, with a counter of the payload copies.
+ * -------------------------------------------------------------------------- */
+PerfWorkloads bench_workloads(BenchConfig const& config);
+
+/** ---------------------------------------------------------------------------
+ * @brief Strategy for the benchmark action that benchmarks Maybe and Either
+ * chains instead of running the demos.
+ *
+ * Each chain passes a payload of `payload_bytes` through `chain_length`
+ * stages; a fraction `error_rate` of the chains fail at a random stage and
+ * short-circuit the rest. The chains run in a tight loop on `threads`
+ * threads without any output, and the report gives the throughput and the
+ * latency percentiles of a whole chain for each monad.
+ * -------------------------------------------------------------------------- */
+class MaybeEitherBenchImplementation
+{
+public:
+    explicit MaybeEitherBenchImplementation(BenchConfig const& config)
+        : m_Config(config) {}
+
+    /** -----------------------------------------------------------------------
+     * @brief Runs the benchmark and prints the report.
+     *
+     * @param action    A constant reference to the BenchmarkAction object.
+     * @param exec_name The name the program was invoked under.
+     * @return EXIT_SUCCESS, or EXIT_FAILURE if the configuration is invalid.
+     * ---------------------------------------------------------------------- */
+    int operator()(
+        BenchmarkAction const& action,
+        std::string_view const& exec_name
+    ) const;
+
+private:
+    BenchConfig m_Config;
+};
+
+// End of 'MaybeEitherBenchImplementation.h'
@@ -0,0 +1,421 @@
+// ============================================================================
+// Provides combinators evaluating independent Maybe/Either computations.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MaybeEitherConcurrent.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "Cancellation.h"
+#include "Either.h"
+#include "Maybe.h"
+
+// Standard library headers
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Combines several `Maybe` values into a `Maybe` of a tuple.
+ *
+ * @tparam Ts The value types of the input `Maybe` objects.
+ * @param mbs The `Maybe` objects to combine.
+ * @return A `Maybe` holding the tuple of all values if every input holds a
+ * value, otherwise an empty `Maybe`.
+ *
+ * @note noexcept when moving every value can't throw.
+ * -------------------------------------------------------------------------- */
+template <typename... Ts>
+auto zip(Maybe<Ts>... mbs)
+  noexcept((std::is_nothrow_move_constructible_v<Ts> && ...))
+  -> Maybe<std::tuple<Ts...>> {
+  static_assert(0 < sizeof...(Ts), "zip requires at least one argument");
+
+  if (ON_SUCCESS_PATH((mbs.has_value() && ...))) {
+    return std::tuple<Ts...>{std::move(*mbs)...};
+  }
+
+  return {};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Combines several `Either` values into an `Either` of a tuple.
+ *
+ * @tparam Ts The successful value types of the input `Either` objects.
+ * @param es The `Either` objects to combine.
+ * @return An `Either` holding the tuple of all successful values, or the
+ * error of the leftmost input holding an error.
+ *
+ * @note noexcept when moving every value and copying the error can't throw.
+ * -------------------------------------------------------------------------- */
+template <typename... Ts>
+auto zip(Either<Ts>... es)
+  noexcept(
+    (std::is_nothrow_move_constructible_v<Ts> && ...)
+      && std::is_nothrow_copy_constructible_v<Err>
+  )
+  -> Either<std::tuple<Ts...>> {
+  static_assert(0 < sizeof...(Ts), "zip requires at least one argument");
+
+  Err const* err = nullptr;
+  ((err = nullptr != err || 0 == es.index() ? err : &std::get<Err>(es)), ...);
+  if (ON_ERROR_PATH(nullptr != err)) {
+    return Either<std::tuple<Ts...>>(*err);
+  }
+
+  return std::tuple<Ts...>{std::get<0>(std::move(es))...};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Invokes \p f, passing \p token along if \p f accepts it.
+ *
+ * Lets the concurrent combinators accept both plain nullary callables and
+ * callables that poll a `CancellationToken` to stop early.
+ * -------------------------------------------------------------------------- */
+template <typename F>
+decltype(auto) invoke_with_token(F& f, CancellationToken const& token) {
+  if constexpr (std::is_invocable_v<F&, CancellationToken const&>) {
+    return std::invoke(f, token);
+  } else {
+    return std::invoke(f);
+  }
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief The monadic type returned by `invoke_with_token()` for \p F.
+ * -------------------------------------------------------------------------- */
+template <typename F>
+using token_invoke_result_t = std::decay_t<decltype(
+  invoke_with_token(std::declval<F&>(), std::declval<CancellationToken const&>())
+)>;
+
+/** ---------------------------------------------------------------------------
+ * @brief Shared state of a `when_all()` call.
+ *
+ * Owned jointly by the caller and every task, so the caller may return as
+ * soon as the outcome is known while cancelled siblings wind down on their
+ * own.
+ *
+ * @tparam Fs The (decayed) callable types.
+ * -------------------------------------------------------------------------- */
+template <typename... Fs>
+struct WhenAllState {
+  using Values = std::tuple<
+    std::optional<std::variant_alternative_t<0, token_invoke_result_t<Fs>>>...
+  >;
+
+  template <typename... Gs>
+  explicit WhenAllState(Gs&&... gs)
+    : tasks(std::forward<Gs>(gs)...), remaining(sizeof...(Fs)) { }
+
+  template <std::size_t I>
+  void run() {
+    if (!source.is_cancelled()) {
+      try {
+        auto r = invoke_with_token(std::get<I>(tasks), source.token());
+        if (ON_SUCCESS_PATH(0 == r.index())) {
+          std::get<I>(values).emplace(std::get<0>(std::move(r)));
+        } else {
+          fail(std::get<Err>(std::move(r)), nullptr);
+        }
+      } catch (...) {
+        fail(std::nullopt, std::current_exception());
+      }
+    }
+
+    std::lock_guard<std::mutex> lock{mutex};
+    if (0 == --remaining && !done) {
+      done = true;
+      finished.notify_all();
+    }
+  }
+
+  void fail(std::optional<Err> err, std::exception_ptr ex) {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (!done) {
+      error = std::move(err);
+      exception = std::move(ex);
+      done = true;
+      source.cancel();
+      finished.notify_all();
+    }
+  }
+
+  std::tuple<Fs...> tasks;
+  Values values;
+  std::optional<Err> error;
+  std::exception_ptr exception;
+  CancellationSource source;
+  std::mutex mutex;
+  std::condition_variable finished;
+  std::size_t remaining;
+  bool done = false;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Submits the tasks with indices \p Is of \p state to \p executor.
+ * -------------------------------------------------------------------------- */
+template <typename Executor, typename State, std::size_t... Is>
+void submit_tasks(
+  Executor& executor,
+  std::shared_ptr<State> const& state,
+  std::index_sequence<Is...>
+) {
+  (executor.execute([state] { state->template run<Is>(); }), ...);
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Tells whether \p Executor can run its queued tasks on a waiting
+ * worker (see `ThreadPoolExecutor::run_one()`).
+ * -------------------------------------------------------------------------- */
+template <typename Executor, typename = void>
+struct is_helping_executor : std::false_type { };
+
+template <typename Executor>
+struct is_helping_executor<Executor, std::void_t<
+  decltype(std::declval<Executor const&>().is_worker()),
+  decltype(std::declval<Executor&>().run_one())
+>> : std::true_type { };
+
+/** ---------------------------------------------------------------------------
+ * @brief Waits until \p state is done.
+ *
+ * On a worker of \p executor, the queued tasks are run meanwhile. Once the
+ * queue is empty, every task of \p state has been taken by a worker, so
+ * blocking can no longer starve them.
+ * -------------------------------------------------------------------------- */
+template <typename Executor, typename State>
+void wait_done(Executor& executor, State& state) {
+  if constexpr (is_helping_executor<Executor>::value) {
+    if (executor.is_worker()) {
+      for (;;) {
+        {
+          std::lock_guard<std::mutex> lock{state.mutex};
+          if (state.done) {
+            return;
+          }
+        }
+        if (!executor.run_one()) {
+          break;
+        }
+      }
+    }
+  }
+
+  std::unique_lock<std::mutex> lock{state.mutex};
+  state.finished.wait(lock, [&] { return state.done; });
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Evaluates independent `Either`-producing callables concurrently and
+ * combines their results.
+ *
+ * Every callable is submitted to \p executor and the calling thread only
+ * waits for the outcome. Each callable is invoked either with no arguments
+ * or, if it accepts one, with a `CancellationToken` it may poll to stop
+ * early. As soon as any callable yields an error (or throws), the token is
+ * cancelled, callables that have not started yet are skipped, and
+ * `when_all()` returns that error without waiting for the running siblings.
+ * On success the latency is that of the slowest callable rather than the sum
+ * of all of them.
+ *
+ * @tparam Executor Any type providing `execute(std::function<void()>)`, e.g.
+ * `ThreadPoolExecutor`.
+ * @tparam Fs The callable types, each returning an `Either`.
+ * @param executor The executor running the callables.
+ * @param fs The callables to evaluate.
+ * @return An `Either` holding the tuple of all successful values, or the
+ * first error observed.
+ *
+ * @note Callables are decay-copied into state shared with the running tasks
+ * and may outlive the call, so they must own everything they capture. The
+ * executor must outlive every submitted task. Calling `when_all()` from a
+ * task running on \p executor blocks that worker, which can deadlock a
+ * pool whose workers all wait, unless the executor provides `is_worker()`
+ * and `run_one()` as `ThreadPoolExecutor` does; the waiting worker then
+ * runs queued tasks itself.
+ * -------------------------------------------------------------------------- */
+template <typename Executor, typename... Fs>
+auto when_all(Executor&& executor, Fs&&... fs) {
+  static_assert(0 < sizeof...(Fs), "when_all requires at least one callable");
+
+  using State = WhenAllState<std::decay_t<Fs>...>;
+  using Result = Either<std::tuple<
+    std::variant_alternative_t<0, token_invoke_result_t<std::decay_t<Fs>>>...
+  >>;
+
+  auto state = std::make_shared<State>(std::forward<Fs>(fs)...);
+
+  submit_tasks(executor, state, std::make_index_sequence<sizeof...(Fs)>{});
+  wait_done(executor, *state);
+
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+  if (state->error) {
+    return Result(*state->error);
+  }
+
+  return std::apply(
+    [](auto&... values) {
+      return Result(std::in_place_index<0>, std::move(*values)...);
+    },
+    state->values
+  );
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Shared state of a `first_of()` call.
+ *
+ * @tparam M The monadic type produced by every alternative.
+ * @tparam Fs The (decayed) callable types.
+ * -------------------------------------------------------------------------- */
+template <typename M, typename... Fs>
+struct FirstOfState {
+  template <typename... Gs>
+  explicit FirstOfState(Gs&&... gs)
+    : tasks(std::forward<Gs>(gs)...), remaining(sizeof...(Fs)) { }
+
+  template <std::size_t I>
+  void run() {
+    std::optional<M> failure;
+    std::exception_ptr ex;
+    if (!source.is_cancelled()) {
+      try {
+        M r = invoke_with_token(std::get<I>(tasks), source.token());
+        if (ON_SUCCESS_PATH(has_succeeded(r))) {
+          succeed(std::move(r));
+        } else {
+          failure.emplace(std::move(r));
+        }
+      } catch (...) {
+        ex = std::current_exception();
+      }
+    }
+
+    std::lock_guard<std::mutex> lock{mutex};
+    if (failure && !done) {
+      result = std::move(failure);
+    } else if (ex && !result) {
+      exception = std::move(ex);
+    }
+    if (0 == --remaining && !done) {
+      done = true;
+      finished.notify_all();
+    }
+  }
+
+  void succeed(M&& r) {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (!done) {
+      result.emplace(std::move(r));
+      exception = nullptr;
+      done = true;
+      source.cancel();
+      finished.notify_all();
+    }
+  }
+
+  std::tuple<Fs...> tasks;
+  std::optional<M> result;
+  std::exception_ptr exception;
+  CancellationSource source;
+  std::mutex mutex;
+  std::condition_variable finished;
+  std::size_t remaining;
+  bool done = false;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Races alternative `Maybe`/`Either`-producing callables and returns
+ * the first success.
+ *
+ * All alternatives start at once: every callable is submitted to \p executor
+ * and the calling thread only waits for the outcome. The first
+ * alternative to succeed wins, the shared `CancellationToken` is cancelled so
+ * the others can stop early, and `first_of()` returns without waiting for
+ * them. A fast but unreliable source can thus be raced against a slow,
+ * reliable one without paying the latency of the failed attempt.
+ *
+ * @tparam Executor Any type providing `execute(std::function<void()>)`.
+ * @tparam Fs The callable types, all returning the same `Maybe<T>` or
+ * `Either<T>`, optionally taking a `CancellationToken`.
+ * @param executor The executor running the alternatives.
+ * @param fs The alternatives to race.
+ * @return The first successful result. If every alternative fails, the
+ * failure of the last one to finish (Nothing or its error); if all of them
+ * threw, the exception of one of them is rethrown.
+ *
+ * @note Same ownership and executor rules as `when_all()`: the callables are
+ * decay-copied, may outlive the call, and must own everything they capture;
+ * called from a task of \p executor, only an executor providing
+ * `is_worker()` and `run_one()` is safe from deadlock.
+ * -------------------------------------------------------------------------- */
+template <typename Executor, typename F, typename... Fs>
+auto first_of(Executor&& executor, F&& f, Fs&&... fs) {
+  using M = token_invoke_result_t<std::decay_t<F>>;
+  static_assert(
+    std::conjunction_v<
+      std::is_same<M, token_invoke_result_t<std::decay_t<Fs>>>...
+    >,
+    "first_of requires all alternatives to return the same type"
+  );
+
+  using State = FirstOfState<M, std::decay_t<F>, std::decay_t<Fs>...>;
+  auto state = std::make_shared<State>(
+    std::forward<F>(f),
+    std::forward<Fs>(fs)...
+  );
+
+  submit_tasks(executor, state, std::make_index_sequence<1 + sizeof...(Fs)>{});
+  wait_done(executor, *state);
+
+  if (!state->result) {
+    std::rethrow_exception(state->exception);
+  }
+
+  return std::move(*state->result);
+}
+
+// End of 'MaybeEitherConcurrent.h'
@@ -0,0 +1,353 @@
+// ============================================================================
+// Provides C++20 coroutine (do-notation) support for the Maybe/Either monads.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MaybeEitherCoroutine.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "Either.h"
+#include "Maybe.h"
+
+// The rest of this header requires compiler support for C++20 coroutines.
+// Without it the header reduces to the plain C++17 Maybe/Either API.
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#define MAYBE_EITHER_HAS_COROUTINES 1
+
+// Project headers
+#include "FramePool.h"
+
+// Standard library headers
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Owner of the frame of a finished monadic coroutine.
+ *
+ * Monadic coroutines run eagerly: by the time the call returns the task,
+ * the coroutine has either completed or short-circuited, and its result
+ * waits in the promise. The task is the sole owner of the frame and
+ * destroys it when released or destroyed, so no frame outlives its task
+ * however the compiler orders the creation of the return object.
+ *
+ * @tparam M The monadic type produced (`Maybe<R>` or `Either<R>`).
+ * @tparam Promise The promise type of the coroutine.
+ * -------------------------------------------------------------------------- */
+template <typename M, typename Promise>
+class MonadicTask {
+public:
+  using promise_type = Promise;
+  using Handle = std::coroutine_handle<Promise>;
+
+  explicit MonadicTask(Handle handle) noexcept : handle_(handle) { }
+
+  MonadicTask(MonadicTask&& other) noexcept
+    : handle_(std::exchange(other.handle_, nullptr)) { }
+
+  MonadicTask& operator=(MonadicTask&& other) noexcept {
+    std::swap(handle_, other.handle_);
+    return *this;
+  }
+
+  ~MonadicTask() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Moves the result out of the coroutine and releases its frame.
+   * @throws Whatever escaped the coroutine body.
+   * ------------------------------------------------------------------------ */
+  M result() && {
+    MonadicTask owner{std::move(*this)};
+    Promise& promise = owner.handle_.promise();
+    if (promise.exception) {
+      std::rethrow_exception(promise.exception);
+    }
+
+    return std::move(*promise.result);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Converts a task returned by a call straight into its result.
+   *
+   * @code
+   * Maybe<int> r = sum(a, b);
+   * @endcode
+   * ------------------------------------------------------------------------ */
+  operator M() && {
+    return std::move(*this).result();
+  }
+
+private:
+  Handle handle_;
+};
+
+template <typename R>
+struct MaybePromise;
+
+template <typename R>
+struct EitherPromise;
+
+/** ---------------------------------------------------------------------------
+ * @brief Return type of coroutines producing a `Maybe<R>`.
+ *
+ * Inside such a coroutine `co_await mb` yields the value held by \p mb, or
+ * makes the whole coroutine produce an empty `Maybe<R>` if \p mb is empty:
+ *
+ * @code
+ * auto sum(Maybe<int> a, Maybe<int> b) -> MaybeTask<int> {
+ *   co_return co_await a + co_await b;
+ * }
+ * @endcode
+ * -------------------------------------------------------------------------- */
+template <typename R>
+class MaybeTask : public MonadicTask<Maybe<R>, MaybePromise<R>> {
+public:
+  using MonadicTask<Maybe<R>, MaybePromise<R>>::MonadicTask;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Return type of coroutines producing an `Either<R>`.
+ *
+ * Inside such a coroutine `co_await e` yields the successful value held by
+ * \p e, or makes the whole coroutine produce the error held by \p e.
+ * -------------------------------------------------------------------------- */
+template <typename R>
+class EitherTask : public MonadicTask<Either<R>, EitherPromise<R>> {
+public:
+  using MonadicTask<Either<R>, EitherPromise<R>>::MonadicTask;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Common promise machinery shared by the Maybe and Either coroutines.
+ *
+ * A monadic coroutine never suspends except to short-circuit: every
+ * `co_await` on a present value resumes immediately, and `co_await` on an
+ * absent value (Nothing or Left) records the failure in the promise and
+ * leaves the coroutine suspended. Control then returns to the caller, whose
+ * task extracts the result and destroys the frame, running the destructors
+ * of all live locals. An exception escaping the coroutine body is kept in
+ * the promise and rethrown when the result is taken from the task; letting
+ * it escape the initial call instead would leave it to the compiler whether
+ * the frame is released, and compilers disagree.
+ *
+ * Coroutine frames are allocated from the per-thread `FramePool`, so a
+ * monadic coroutine invoked in a loop costs no global heap traffic after the
+ * first call.
+ *
+ * @tparam M The monadic type produced by the coroutine (`Maybe<R>` or
+ * `Either<R>`).
+ * @tparam Task The return type of the coroutine.
+ * @tparam Promise The concrete promise type deriving from this base.
+ * -------------------------------------------------------------------------- */
+template <typename M, typename Task, typename Promise>
+struct MonadicPromiseBase {
+  /** -------------------------------------------------------------------------
+   * @brief Coroutine result, empty until the coroutine returns or
+   * short-circuits.
+   * ------------------------------------------------------------------------ */
+  std::optional<M> result;
+
+  /** -------------------------------------------------------------------------
+   * @brief The exception that escaped the coroutine body, if any.
+   * ------------------------------------------------------------------------ */
+  std::exception_ptr exception;
+
+  Task get_return_object() noexcept {
+    return Task{
+      std::coroutine_handle<Promise>::from_promise(
+        static_cast<Promise&>(*this)
+      )
+    };
+  }
+
+  std::suspend_never initial_suspend() noexcept { return {}; }
+  std::suspend_always final_suspend() noexcept { return {}; }
+
+  void unhandled_exception() noexcept {
+    exception = std::current_exception();
+  }
+
+  static void* operator new(std::size_t size) {
+    return FramePool::allocate(size);
+  }
+
+  static void operator delete(void* ptr, std::size_t size) noexcept {
+    FramePool::deallocate(ptr, size);
+  }
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Awaiter produced by `co_await` on a `Maybe<T>`.
+ *
+ * Resumes with the contained value if present, otherwise stores an empty
+ * result in the awaiting promise and leaves the coroutine suspended.
+ *
+ * @tparam M The (possibly const, possibly reference) `Maybe` being awaited.
+ * @tparam R The result type of the awaiting coroutine.
+ * -------------------------------------------------------------------------- */
+template <typename M, typename R>
+struct MaybeAwaiter {
+  M maybe;
+
+  bool await_ready() const noexcept {
+    return ON_SUCCESS_PATH(maybe.has_value());
+  }
+
+  void await_suspend(std::coroutine_handle<MaybePromise<R>> handle) const {
+    handle.promise().result.emplace();
+  }
+
+  decltype(auto) await_resume() {
+    return *std::forward<M>(maybe);
+  }
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Awaiter produced by `co_await` on an `Either<T>`.
+ *
+ * Resumes with the successful value if present, otherwise propagates the
+ * error into the awaiting promise and leaves the coroutine suspended.
+ *
+ * @tparam E The (possibly const, possibly reference) `Either` being awaited.
+ * @tparam R The successful value type of the awaiting coroutine.
+ * -------------------------------------------------------------------------- */
+template <typename E, typename R>
+struct EitherAwaiter {
+  E either;
+
+  bool await_ready() const noexcept {
+    return ON_SUCCESS_PATH(0 == either.index());
+  }
+
+  void await_suspend(std::coroutine_handle<EitherPromise<R>> handle) {
+    handle.promise().result.emplace(
+      std::in_place_index<1>,
+      std::get<1>(std::forward<E>(either))
+    );
+  }
+
+  decltype(auto) await_resume() {
+    return std::get<0>(std::forward<E>(either));
+  }
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Promise type of coroutines returning `MaybeTask<R>`.
+ *
+ * Only `Maybe` values and the tasks of other `Maybe` coroutines may be
+ * awaited; `co_return` accepts anything convertible to `Maybe<R>`, including
+ * `std::nullopt`.
+ *
+ * @tparam R The value type of the resulting `Maybe`.
+ * -------------------------------------------------------------------------- */
+template <typename R>
+struct MaybePromise
+  : MonadicPromiseBase<Maybe<R>, MaybeTask<R>, MaybePromise<R>> {
+  template <typename U = Maybe<R>>
+  void return_value(U&& value) {
+    this->result.emplace(std::forward<U>(value));
+  }
+
+  template <typename T>
+  auto await_transform(Maybe<T>& mb) noexcept {
+    return MaybeAwaiter<Maybe<T>&, R>{mb};
+  }
+
+  template <typename T>
+  auto await_transform(Maybe<T> const& mb) noexcept {
+    return MaybeAwaiter<Maybe<T> const&, R>{mb};
+  }
+
+  template <typename T>
+  auto await_transform(Maybe<T>&& mb) noexcept {
+    return MaybeAwaiter<Maybe<T>&&, R>{std::move(mb)};
+  }
+
+  template <typename T>
+  auto await_transform(MaybeTask<T>&& task) {
+    return MaybeAwaiter<Maybe<T>, R>{std::move(task).result()};
+  }
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Promise type of coroutines returning `EitherTask<R>`.
+ *
+ * Only `Either` values and the tasks of other `Either` coroutines may be
+ * awaited; `co_return` accepts a value of type \p R as well as any error
+ * derived from `Err`.
+ *
+ * @tparam R The successful value type of the resulting `Either`.
+ * -------------------------------------------------------------------------- */
+template <typename R>
+struct EitherPromise
+  : MonadicPromiseBase<Either<R>, EitherTask<R>, EitherPromise<R>> {
+  template <typename U = Either<R>>
+  void return_value(U&& value) {
+    this->result.emplace(std::forward<U>(value));
+  }
+
+  template <typename T>
+  auto await_transform(Either<T>& e) noexcept {
+    return EitherAwaiter<Either<T>&, R>{e};
+  }
+
+  template <typename T>
+  auto await_transform(Either<T> const& e) noexcept {
+    return EitherAwaiter<Either<T> const&, R>{e};
+  }
+
+  template <typename T>
+  auto await_transform(Either<T>&& e) noexcept {
+    return EitherAwaiter<Either<T>&&, R>{std::move(e)};
+  }
+
+  template <typename T>
+  auto await_transform(EitherTask<T>&& task) {
+    return EitherAwaiter<Either<T>, R>{std::move(task).result()};
+  }
+};
+
+#endif  // __cpp_impl_coroutine
+
+// End of 'MaybeEitherCoroutine.h'
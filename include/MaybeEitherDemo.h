@@ -42,6 +42,9 @@
 #include "MaybeEitherCommon.h"
 
 // Standard library headers
+#include <cstddef>
+#include <string>
+#include <vector>
 
 // External library headers
 #include <clipp/clipp.hpp>
@@ -62,6 +65,14 @@ struct CliOptionValues
     bool m_ShowHelp;
     bool m_PrintUsage;
     bool m_ShowVersion;
+    std::string m_TraceFile;
+    bool m_Bench;
+    bool m_Profile;
+    std::size_t m_Iterations;
+    std::size_t m_Threads;
+    std::size_t m_ChainLength;
+    std::size_t m_PayloadBytes;
+    double m_ErrorRate;
 };
 
 // Define the default values for the command line options
@@ -70,7 +81,15 @@ static CliOptionValues userOptionValues
     {},          // m_Unsupported
     false,       // m_ShowHelp
     false,       // m_PrintUsage
-    false        // m_ShowVersion
+    false,       // m_ShowVersion
+    {},          // m_TraceFile
+    false,       // m_Bench
+    false,       // m_Profile
+    1000000,     // m_Iterations
+    1,           // m_Threads
+    8,           // m_ChainLength
+    64,          // m_PayloadBytes
+    0.01         // m_ErrorRate
 };
 
 
@@ -103,8 +122,46 @@ auto appOptions = (
         (
             clipp::option("-V", "--version")
                 .set(userOptionValues.m_ShowVersion)
-        ).doc(kVersionOptionDoc.data())
+        ).doc(kVersionOptionDoc.data()),
+        (
+            clipp::option("--trace")
+            & clipp::value(
+                clipp::match::prefix_not("-"),
+                "FILE",
+                userOptionValues.m_TraceFile
+            )
+        ).doc(kTraceOptionDoc.data())
     ).doc("general options:"),
+    (
+        (
+            clipp::option("--bench")
+                .set(userOptionValues.m_Bench)
+        ).doc(kBenchOptionDoc.data()),
+        (
+            clipp::option("--profile")
+                .set(userOptionValues.m_Profile)
+        ).doc(kProfileOptionDoc.data()),
+        (
+            clipp::option("--iterations")
+            & clipp::value("N", userOptionValues.m_Iterations)
+        ).doc(kIterationsOptionDoc.data()),
+        (
+            clipp::option("--threads")
+            & clipp::value("N", userOptionValues.m_Threads)
+        ).doc(kThreadsOptionDoc.data()),
+        (
+            clipp::option("--chain-length")
+            & clipp::value("N", userOptionValues.m_ChainLength)
+        ).doc(kChainLengthOptionDoc.data()),
+        (
+            clipp::option("--payload-bytes")
+            & clipp::value("N", userOptionValues.m_PayloadBytes)
+        ).doc(kPayloadBytesOptionDoc.data()),
+        (
+            clipp::option("--error-rate")
+            & clipp::value("RATE", userOptionValues.m_ErrorRate)
+        ).doc(kErrorRateOptionDoc.data())
+    ).doc("benchmark options:"),
     // (
     //     clipp::value(
     //         clipp::match::prefix_not("-"),
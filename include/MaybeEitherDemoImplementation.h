@@ -43,6 +43,7 @@
 #include <cmath>
 #include <exception>
 #include <iostream>
+#include <string>
 #include <string_view>
 
 // ============================================================================
@@ -64,6 +65,13 @@ public:
      * ---------------------------------------------------------------------- */
     explicit MaybeEitherDemoImplementation() = default;
 
+    /** -----------------------------------------------------------------------
+     * @brief Constructs the demo so that it traces the chained pipelines and
+     * writes them to trace_file as a Chrome trace.
+     * ---------------------------------------------------------------------- */
+    explicit MaybeEitherDemoImplementation(std::string trace_file)
+        : m_TraceFile(std::move(trace_file)) {}
+
     /** -----------------------------------------------------------------------
      * @brief Executes the main program action.
      *
@@ -84,6 +92,9 @@ public:
         MainProgramAction const& action,
         std::string_view const& exec_name
     ) const;
+
+private:
+    std::string m_TraceFile;  // Empty unless tracing was requested
 };
 
 // End of 'MaybeEitherDemoImplementation.h'
\ No newline at end of file
@@ -0,0 +1,588 @@
+// ============================================================================
+// Provides a Prometheus text-format metrics registry for pipelines.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MetricsRegistry.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "CycleClock.h"
+#include "Either.h"
+#include "ErrorCode.h"
+#include "LatencyHistogram.h"
+#include "Maybe.h"
+#include "StageHooks.h"
+
+// Standard library headers
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief What happened to a pipeline or one of its stages.
+ * -------------------------------------------------------------------------- */
+enum MetricOutcome : std::size_t {
+  kMetricSucceeded = 0,
+  kMetricFailed = 1,
+  kMetricSkipped = 2
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Outcome counts, error kinds and stage latencies of one pipeline.
+ *
+ * Obtained from `MetricsRegistry::pipeline()`. Outcome counters are striped
+ * over cache-line aligned slots picked by thread, latencies go into the
+ * per-thread `LatencyHistograms`, so recording a stage never locks and
+ * threads seldom touch the same cache line. Error kinds are kept in a small
+ * lock-free table keyed by stage and `error_code()`; it is only touched when
+ * a stage fails.
+ * -------------------------------------------------------------------------- */
+class PipelineMetrics {
+public:
+  static constexpr std::size_t kMaxStages = LatencyHistograms::kMaxStages;
+  static constexpr std::size_t kStripes = 16;
+  static constexpr std::size_t kErrorKinds = 64;
+
+  /** -------------------------------------------------------------------------
+   * @brief Error count of one stage and error kind.
+   * ------------------------------------------------------------------------ */
+  struct ErrorKind {
+    std::size_t stage;
+    std::string kind;
+    std::uint64_t count;
+  };
+
+  PipelineMetrics(std::string name, std::vector<std::string> stages)
+    : name_(std::move(name)), stages_(stages), latency_(std::move(stages)) { }
+
+  PipelineMetrics(PipelineMetrics const&) = delete;
+  PipelineMetrics& operator=(PipelineMetrics const&) = delete;
+
+  ~PipelineMetrics() {
+    for (auto& slot : errors_) {
+      delete slot.kind.load(std::memory_order_relaxed);
+    }
+  }
+
+  std::string const& name() const noexcept { return name_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Label of \p stage; unnamed stages are "stage N".
+   * ------------------------------------------------------------------------ */
+  std::string stage_name(std::size_t stage) const {
+    return stage < stages_.size() && !stages_[stage].empty()
+      ? stages_[stage]
+      : "stage " + std::to_string(stage);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Counts one \p outcome of \p stage.
+   * ------------------------------------------------------------------------ */
+  void count_stage(std::size_t stage, MetricOutcome outcome) noexcept {
+    if (kMaxStages <= stage) {
+      return;
+    }
+
+    stripe().stages[stage][outcome].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Counts one \p outcome of the whole pipeline.
+   * ------------------------------------------------------------------------ */
+  void count_pipeline(MetricOutcome outcome) noexcept {
+    stripe().pipeline[outcome].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Records that \p stage ran for \p ticks `CycleClock` ticks.
+   * ------------------------------------------------------------------------ */
+  void time_stage(std::size_t stage, std::uint64_t ticks) {
+    latency_.record(stage, ticks);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Counts one error of \p stage, of the kind described by \p what.
+   *
+   * Kinds that no longer fit the table are counted as "other".
+   * ------------------------------------------------------------------------ */
+  void count_error(std::size_t stage, char const* what) {
+    if (kMaxStages <= stage) {
+      return;
+    }
+
+    // Keys are never 0, which marks a free slot.
+    std::uint64_t key = (std::uint64_t{stage + 1} << 32) | error_code(what);
+    std::size_t start = static_cast<std::size_t>(key * 0x9E3779B97F4A7C15ull
+      >> 58);
+
+    for (std::size_t i = 0; i < kErrorKinds; ++i) {
+      auto& slot = errors_[(start + i) % kErrorKinds];
+      std::uint64_t seen = slot.key.load(std::memory_order_acquire);
+
+      if (0 == seen
+        && slot.key.compare_exchange_strong(
+             seen,
+             key,
+             std::memory_order_acq_rel
+           )) {
+        slot.kind.store(new std::string{what}, std::memory_order_release);
+        seen = key;
+      }
+
+      if (key == seen) {
+        slot.count.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+    }
+
+    other_errors_[stage].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Sum of the \p outcome counts of \p stage over all stripes.
+   * ------------------------------------------------------------------------ */
+  std::uint64_t stage_count(std::size_t stage, MetricOutcome outcome) const {
+    std::uint64_t total = 0;
+    for (auto const& s : stripes_) {
+      total += s.stages[stage][outcome].load(std::memory_order_relaxed);
+    }
+
+    return total;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Sum of the \p outcome counts of the pipeline over all stripes.
+   * ------------------------------------------------------------------------ */
+  std::uint64_t pipeline_count(MetricOutcome outcome) const {
+    std::uint64_t total = 0;
+    for (auto const& s : stripes_) {
+      total += s.pipeline[outcome].load(std::memory_order_relaxed);
+    }
+
+    return total;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief The error counts recorded so far, "other" kinds included.
+   * ------------------------------------------------------------------------ */
+  std::vector<ErrorKind> errors() const {
+    std::vector<ErrorKind> result{};
+
+    for (auto const& slot : errors_) {
+      std::uint64_t key = slot.key.load(std::memory_order_acquire);
+      std::string const* kind = slot.kind.load(std::memory_order_acquire);
+
+      // A slot being claimed right now shows up in the next dump.
+      if (0 == key || nullptr == kind) {
+        continue;
+      }
+
+      result.push_back({
+        static_cast<std::size_t>((key >> 32) - 1),
+        *kind,
+        slot.count.load(std::memory_order_relaxed)
+      });
+    }
+
+    for (std::size_t stage = 0; stage < kMaxStages; ++stage) {
+      if (auto n = other_errors_[stage].load(std::memory_order_relaxed)) {
+        result.push_back({stage, "other", n});
+      }
+    }
+
+    return result;
+  }
+
+  std::vector<StageLatency> latency() const { return latency_.snapshot(); }
+
+private:
+  using Counters = std::array<std::atomic<std::uint64_t>, 3>;
+
+  struct alignas(64) Stripe {
+    Counters pipeline{};
+    std::array<Counters, kMaxStages> stages{};
+  };
+
+  struct ErrorSlot {
+    std::atomic<std::uint64_t> key{0};
+    std::atomic<std::string*> kind{nullptr};
+    std::atomic<std::uint64_t> count{0};
+  };
+
+  Stripe& stripe() noexcept {
+    static std::atomic<std::size_t> next{0};
+    thread_local std::size_t const index
+      = next.fetch_add(1, std::memory_order_relaxed) % kStripes;
+
+    return stripes_[index];
+  }
+
+  std::string name_;
+  std::vector<std::string> stages_;
+  LatencyHistograms latency_;
+  std::array<Stripe, kStripes> stripes_{};
+  std::array<ErrorSlot, kErrorKinds> errors_{};
+  std::array<std::atomic<std::uint64_t>, kMaxStages> other_errors_{};
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Process-wide registry of pipeline metrics.
+ *
+ * Dumps every registered pipeline in the Prometheus text exposition format,
+ * either on demand with `write()` or periodically into a file with
+ * `start_dumping()`. Periodic dumps are written to a temporary file and
+ * renamed over the target, so a scraper never reads a partial dump.
+ * -------------------------------------------------------------------------- */
+class MetricsRegistry {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  static MetricsRegistry& instance() {
+    static MetricsRegistry registry{};
+    return registry;
+  }
+
+  MetricsRegistry(MetricsRegistry const&) = delete;
+  MetricsRegistry& operator=(MetricsRegistry const&) = delete;
+
+  ~MetricsRegistry() {
+    stop_dumping();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief The metrics of the pipeline called \p name, created on first use.
+   *
+   * @param name The value of the `pipeline` label.
+   * @param stages Labels of the stages in order; ignored if the pipeline
+   * already exists.
+   * @return A reference that stays valid for the life of the registry.
+   * ------------------------------------------------------------------------ */
+  PipelineMetrics& pipeline(
+    std::string const& name,
+    std::vector<std::string> stages = {}
+  ) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    for (auto const& p : pipelines_) {
+      if (name == p->name()) {
+        return *p;
+      }
+    }
+
+    pipelines_.push_back(
+      std::make_unique<PipelineMetrics>(name, std::move(stages))
+    );
+
+    return *pipelines_.back();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Writes all metrics to \p out in Prometheus text format.
+   * ------------------------------------------------------------------------ */
+  void write(std::ostream& out) const {
+    static constexpr std::array<char const*, 3> kOutcomes{{
+      "succeeded",
+      "failed",
+      "skipped"
+    }};
+
+    std::vector<PipelineMetrics const*> pipelines{};
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      for (auto const& p : pipelines_) {
+        pipelines.push_back(p.get());
+      }
+    }
+
+    out << "# HELP monadic_pipeline_outcomes_total"
+           " Pipelines run, by final outcome.\n"
+           "# TYPE monadic_pipeline_outcomes_total counter\n";
+    for (auto const* p : pipelines) {
+      for (std::size_t o = 0; o < kMetricSkipped; ++o) {
+        out << "monadic_pipeline_outcomes_total{pipeline=\""
+            << escape(p->name()) << "\",outcome=\"" << kOutcomes[o] << "\"} "
+            << p->pipeline_count(static_cast<MetricOutcome>(o)) << '\n';
+      }
+    }
+
+    out << "# HELP monadic_stage_outcomes_total"
+           " Stage binds, by outcome.\n"
+           "# TYPE monadic_stage_outcomes_total counter\n";
+    for (auto const* p : pipelines) {
+      for (std::size_t stage = 0; stage < PipelineMetrics::kMaxStages;
+           ++stage) {
+        std::array<std::uint64_t, 3> counts{};
+        for (std::size_t o = 0; o < counts.size(); ++o) {
+          counts[o] = p->stage_count(stage, static_cast<MetricOutcome>(o));
+        }
+        if (0 == counts[0] + counts[1] + counts[2]) {
+          continue;
+        }
+
+        for (std::size_t o = 0; o < counts.size(); ++o) {
+          out << "monadic_stage_outcomes_total{pipeline=\""
+              << escape(p->name()) << "\",stage=\""
+              << escape(p->stage_name(stage)) << "\",outcome=\""
+              << kOutcomes[o] << "\"} " << counts[o] << '\n';
+        }
+      }
+    }
+
+    out << "# HELP monadic_stage_errors_total"
+           " Stage failures, by error kind.\n"
+           "# TYPE monadic_stage_errors_total counter\n";
+    for (auto const* p : pipelines) {
+      for (auto const& e : p->errors()) {
+        out << "monadic_stage_errors_total{pipeline=\""
+            << escape(p->name()) << "\",stage=\""
+            << escape(p->stage_name(e.stage)) << "\",kind=\""
+            << escape(e.kind) << "\"} " << e.count << '\n';
+      }
+    }
+
+    out << "# HELP monadic_stage_latency_seconds"
+           " Time spent in stages that ran.\n"
+           "# TYPE monadic_stage_latency_seconds summary\n";
+    for (auto const* p : pipelines) {
+      for (auto const& s : p->latency()) {
+        std::string labels = "pipeline=\"" + escape(p->name())
+          + "\",stage=\"" + escape(s.name) + "\"";
+
+        for (auto const& q : {std::make_pair("0.5", s.p50),
+                              std::make_pair("0.99", s.p99),
+                              std::make_pair("0.999", s.p999)}) {
+          out << "monadic_stage_latency_seconds{" << labels
+              << ",quantile=\"" << q.first << "\"} " << q.second * 1e-9
+              << '\n';
+        }
+        out << "monadic_stage_latency_seconds_sum{" << labels << "} "
+            << s.mean * s.count * 1e-9 << '\n'
+            << "monadic_stage_latency_seconds_count{" << labels << "} "
+            << s.count << '\n';
+      }
+    }
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Replaces the file at \p path with a dump of all metrics.
+   * @return false if the file can't be written.
+   * ------------------------------------------------------------------------ */
+  bool write(std::string const& path) const {
+    std::string temporary = path + ".tmp";
+    {
+      std::ofstream out{temporary};
+      if (!out) {
+        return false;
+      }
+
+      write(out);
+      if (!out.flush()) {
+        return false;
+      }
+    }
+
+    return 0 == std::rename(temporary.c_str(), path.c_str());
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Starts dumping all metrics to \p path every \p interval.
+   * @return false if dumping is already running.
+   * ------------------------------------------------------------------------ */
+  bool start_dumping(
+    std::string const& path,
+    Clock::duration interval = std::chrono::seconds{10}
+  ) {
+    std::lock_guard<std::mutex> lock{control_};
+    if (dumper_.joinable()) {
+      return false;
+    }
+
+    stopping_ = false;
+    dumper_ = std::thread{[this, path, interval] {
+      std::unique_lock<std::mutex> wait{wakeup_mutex_};
+      while (true) {
+        bool last = wakeup_.wait_for(wait, interval, [this] {
+          return stopping_;
+        });
+        write(path);
+        if (last) {
+          break;
+        }
+      }
+    }};
+
+    return true;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Stops periodic dumping after writing one last dump.
+   * ------------------------------------------------------------------------ */
+  void stop_dumping() {
+    std::lock_guard<std::mutex> lock{control_};
+    if (!dumper_.joinable()) {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> wake{wakeup_mutex_};
+      stopping_ = true;
+    }
+    wakeup_.notify_one();
+    dumper_.join();
+  }
+
+private:
+  MetricsRegistry() = default;
+
+  // Escapes a label value as the exposition format requires.
+  static std::string escape(std::string const& value) {
+    std::string result{};
+    result.reserve(value.size());
+    for (char c : value) {
+      switch (c) {
+        case '\\': result += "\\\\"; break;
+        case '"': result += "\\\""; break;
+        case '\n': result += "\\n"; break;
+        default: result += c;
+      }
+    }
+
+    return result;
+  }
+
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<PipelineMetrics>> pipelines_;
+
+  std::mutex control_;
+  std::mutex wakeup_mutex_;
+  std::condition_variable wakeup_;
+  bool stopping_ = false;
+  std::thread dumper_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Stage hook recording outcomes and stage latencies into
+ * `PipelineMetrics`.
+ *
+ * A stage that runs is timed and counted as succeeded or failed, failures
+ * under the message of their error or as "valueless" for an `Either` left
+ * valueless by an exception; a short-circuited stage is counted as skipped. Releasing the result with
+ * `result() &&` counts the outcome of the whole pipeline.
+ * -------------------------------------------------------------------------- */
+class MetricsHook : public StageHook {
+public:
+  explicit MetricsHook(PipelineMetrics& metrics) noexcept
+    : metrics_(&metrics) { }
+
+  template <typename Out, typename S, typename M, typename Next>
+  Out around(std::size_t index, S const&, M&, Next&& next) {
+    std::uint64_t start = CycleClock::now();
+    Out r = std::forward<Next>(next)();
+    metrics_->time_stage(index, CycleClock::now() - start);
+    count_result(index, r);
+
+    return r;
+  }
+
+  template <typename S>
+  void skipped(std::size_t index, S const&) {
+    metrics_->count_stage(index, kMetricSkipped);
+  }
+
+  template <typename M>
+  void finish(M const& value) {
+    metrics_->count_pipeline(
+      has_succeeded(value) ? kMetricSucceeded : kMetricFailed
+    );
+  }
+
+private:
+  template <typename T>
+  void count_result(std::size_t index, Maybe<T> const& r) {
+    metrics_->count_stage(index, r ? kMetricSucceeded : kMetricFailed);
+  }
+
+  template <typename T>
+  void count_result(std::size_t index, Either<T> const& r) {
+    if (ON_SUCCESS_PATH(0 == r.index())) {
+      metrics_->count_stage(index, kMetricSucceeded);
+    } else {
+      // An Either left valueless by an exception holds no error to name.
+      metrics_->count_stage(index, kMetricFailed);
+      metrics_->count_error(
+        index,
+        1 == r.index() ? std::get_if<1>(&r)->what() : "valueless"
+      );
+    }
+  }
+
+  PipelineMetrics* metrics_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Records the outcomes of the pipeline \p value into \p metrics.
+ *
+ * @code
+ * auto& metrics = MetricsRegistry::instance().pipeline(
+ *   "expensive", {"transform", "accumulate"}
+ * );
+ * auto r = (with_metrics(create_expensive_e(true), metrics)
+ *   | transform_expensive_e
+ *   | accumulate_expensive_e).result();
+ * @endcode
+ *
+ * @param value A `Maybe`/`Either`, or a pipeline started by another
+ * `with_*()` function.
+ * -------------------------------------------------------------------------- */
+template <typename M>
+auto with_metrics(M&& value, PipelineMetrics& metrics) {
+  return attach_hook(std::forward<M>(value), MetricsHook{metrics});
+}
+
+// End of 'MetricsRegistry.h'
@@ -0,0 +1,522 @@
+// ============================================================================
+// Provides Chrome trace-event recording of pipeline stage execution.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * PipelineTrace.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "CycleClock.h"
+#include "Either.h"
+#include "Maybe.h"
+#include "StageHooks.h"
+#include "Symbols.h"
+
+// Standard library headers
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief A stage with a user supplied name for traces.
+ *
+ * Created with `labeled()`. It is an ordinary callable, so it can be used
+ * in any pipeline, traced or not.
+ * -------------------------------------------------------------------------- */
+template <typename F>
+struct LabeledStage {
+  char const* label;
+  F f;
+
+  template <typename T>
+  auto operator()(T&& value) const {
+    return std::invoke(f, std::forward<T>(value));
+  }
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Names \p f \p label in traces.
+ * -------------------------------------------------------------------------- */
+template <typename F>
+auto labeled(char const* label, F&& f) {
+  return LabeledStage<std::decay_t<F>>{label, std::forward<F>(f)};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief What a recorded event is named after: a label, the address of a
+ * function, or the type of a function object. Resolved into a string only
+ * when the trace is written.
+ * -------------------------------------------------------------------------- */
+struct TraceName {
+  char const* label;
+  void const* address;
+  std::type_info const* type;
+
+  std::string resolve() const {
+    if (nullptr != label) {
+      return label;
+    }
+    if (nullptr != address) {
+      return symbol_name(address);
+    }
+    if (nullptr != type) {
+      return demangle(type->name());
+    }
+
+    return "stage";
+  }
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief The trace name of the stage \p f.
+ * -------------------------------------------------------------------------- */
+template <typename F>
+TraceName trace_name_of(F const& f) noexcept {
+  if constexpr (std::is_pointer_v<F>
+    && std::is_function_v<std::remove_pointer_t<F>>) {
+    return {nullptr, reinterpret_cast<void const*>(f), nullptr};
+  } else if constexpr (std::is_function_v<F>) {
+    return {nullptr, reinterpret_cast<void const*>(&f), nullptr};
+  } else {
+    return {nullptr, nullptr, &typeid(F)};
+  }
+}
+
+template <typename F>
+TraceName trace_name_of(LabeledStage<F> const& f) noexcept {
+  return {f.label, nullptr, nullptr};
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Ring buffer of the events recorded by one thread.
+ *
+ * Only the owning thread writes. Each slot is made of relaxed atomics and
+ * the count of written events is published with a release store, so the
+ * trace can be written while threads are still recording; events that get
+ * overwritten while being copied are dropped. Once full, the oldest events
+ * are overwritten.
+ * -------------------------------------------------------------------------- */
+class TraceBuffer {
+public:
+  static constexpr std::size_t kCapacity = 1u << 14;
+
+  /** -------------------------------------------------------------------------
+   * @brief A recorded event, as copied out of the buffer.
+   * ------------------------------------------------------------------------ */
+  struct Event {
+    std::uint64_t begin;
+    std::uint64_t end;
+    TraceName name;
+  };
+
+  explicit TraceBuffer(std::size_t thread) : thread_(thread) { }
+
+  std::size_t thread() const noexcept { return thread_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Empties the buffer and hands it to the thread numbered \p thread.
+   *
+   * Must not race with `record()` or `events()`.
+   * ------------------------------------------------------------------------ */
+  void reset(std::size_t thread) noexcept {
+    thread_ = thread;
+    head_.store(0, std::memory_order_relaxed);
+  }
+
+  void record(std::uint64_t begin, std::uint64_t end, TraceName name) noexcept {
+    std::uint64_t head = head_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[head % kCapacity];
+
+    slot.begin.store(begin, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+    slot.label.store(name.label, std::memory_order_relaxed);
+    slot.address.store(name.address, std::memory_order_relaxed);
+    slot.type.store(name.type, std::memory_order_relaxed);
+
+    head_.store(head + 1, std::memory_order_release);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Copies out the events still held by the buffer, oldest first.
+   * ------------------------------------------------------------------------ */
+  std::vector<Event> events() const {
+    std::uint64_t head = head_.load(std::memory_order_acquire);
+    std::uint64_t first = kCapacity < head ? head - kCapacity : 0;
+
+    std::vector<Event> result{};
+    result.reserve(static_cast<std::size_t>(head - first));
+    for (std::uint64_t i = first; i < head; ++i) {
+      Slot const& slot = slots_[i % kCapacity];
+      result.push_back({
+        slot.begin.load(std::memory_order_relaxed),
+        slot.end.load(std::memory_order_relaxed),
+        {
+          slot.label.load(std::memory_order_relaxed),
+          slot.address.load(std::memory_order_relaxed),
+          slot.type.load(std::memory_order_relaxed)
+        }
+      });
+    }
+
+    // Drop the events the owner overwrote while they were being copied.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    std::uint64_t now = head_.load(std::memory_order_relaxed);
+    std::uint64_t valid = kCapacity < now ? now - kCapacity : 0;
+    if (first < valid) {
+      result.erase(
+        result.begin(),
+        result.begin() + static_cast<std::ptrdiff_t>(
+          std::min<std::uint64_t>(valid - first, result.size())
+        )
+      );
+    }
+
+    return result;
+  }
+
+private:
+  struct Slot {
+    std::atomic<std::uint64_t> begin{0};
+    std::atomic<std::uint64_t> end{0};
+    std::atomic<char const*> label{nullptr};
+    std::atomic<void const*> address{nullptr};
+    std::atomic<std::type_info const*> type{nullptr};
+  };
+
+  std::size_t thread_;
+  std::atomic<std::uint64_t> head_{0};
+  std::array<Slot, kCapacity> slots_{};
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Process-wide switch and collection point of pipeline traces.
+ *
+ * While disabled, traced pipelines pay one relaxed load per stage. A thread
+ * gets a buffer the first time it records. When the thread exits, the events
+ * it recorded are copied out, so they still make it into the trace, and its
+ * buffer is handed to the next thread that records. Threads that come and
+ * go thus don't pile up buffers. Of the events copied out, only the newest
+ * `kMaxRetiredEvents` are kept; older ones are dropped and counted.
+ * -------------------------------------------------------------------------- */
+class Tracer {
+public:
+  static constexpr std::size_t kMaxRetiredEvents = 4 * TraceBuffer::kCapacity;
+
+  static Tracer& instance() {
+    static Tracer tracer{};
+    return tracer;
+  }
+
+  bool enabled() const noexcept {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Starts or stops recording; timestamps are relative to the first
+   * time recording is started.
+   * ------------------------------------------------------------------------ */
+  void enable(bool on = true) {
+    if (on) {
+      std::call_once(started_, [this] { start_ = CycleClock::now(); });
+    }
+    enabled_.store(on, std::memory_order_relaxed);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Records an event on the calling thread.
+   * ------------------------------------------------------------------------ */
+  void record(std::uint64_t begin, std::uint64_t end, TraceName name) {
+    thread_local BufferLease lease{};
+    if (nullptr == lease.buffer) {
+      lease.buffer = acquire_buffer();
+    }
+
+    lease.buffer->record(begin, end, name);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Number of buffers allocated so far, at most the number of threads
+   * that recorded at the same time.
+   * ------------------------------------------------------------------------ */
+  std::size_t buffer_count() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return buffers_.size() + idle_.size();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Number of events of exited threads dropped to stay within
+   * `kMaxRetiredEvents`.
+   * ------------------------------------------------------------------------ */
+  std::uint64_t dropped_events() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return dropped_;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Writes every recorded event in the Chrome trace-event format,
+   * which chrome://tracing and Perfetto open directly.
+   * ------------------------------------------------------------------------ */
+  void write_json(std::ostream& out) const {
+    double us_per_tick = CycleClock::ns_per_tick() / 1000.0;
+    std::vector<ThreadEvents> threads{};
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      threads.assign(retired_.begin(), retired_.end());
+      for (auto const& b : buffers_) {
+        threads.push_back({b->thread(), b->events()});
+      }
+    }
+
+    // Timestamps are in microseconds; keep them to the nanosecond however
+    // long the trace runs.
+    auto flags = out.flags();
+    auto precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (auto const& t : threads) {
+      for (auto const& e : t.events) {
+        out << (first ? "\n" : ",\n")
+          << "{\"name\":\"" << escape(e.name.resolve())
+          << "\",\"cat\":\"pipeline\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+          << t.thread
+          << ",\"ts\":" << relative(e.begin) * us_per_tick
+          << ",\"dur\":" << (e.end - e.begin) * us_per_tick << "}";
+        first = false;
+      }
+    }
+    out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+    out.flags(flags);
+    out.precision(precision);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Writes the trace to the file at \p path.
+   * @return false if the file could not be written.
+   * ------------------------------------------------------------------------ */
+  bool write_json(std::string const& path) const {
+    std::ofstream out{path};
+    if (!out) {
+      return false;
+    }
+    write_json(out);
+
+    return static_cast<bool>(out);
+  }
+
+private:
+  // The events a thread recorded, numbered as in the trace.
+  struct ThreadEvents {
+    std::size_t thread;
+    std::vector<TraceBuffer::Event> events;
+  };
+
+  // Gives the buffer of a thread back when the thread exits.
+  struct BufferLease {
+    TraceBuffer* buffer = nullptr;
+
+    ~BufferLease() {
+      if (nullptr != buffer) {
+        Tracer::instance().release_buffer(buffer);
+      }
+    }
+  };
+
+  Tracer() = default;
+
+  TraceBuffer* acquire_buffer() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    ++threads_;
+    if (!idle_.empty()) {
+      auto buffer = std::move(idle_.back());
+      idle_.pop_back();
+      buffer->reset(threads_);
+      buffers_.push_back(std::move(buffer));
+    } else {
+      buffers_.push_back(std::make_unique<TraceBuffer>(threads_));
+    }
+
+    return buffers_.back().get();
+  }
+
+  void release_buffer(TraceBuffer* buffer) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    auto it = std::find_if(
+      buffers_.begin(),
+      buffers_.end(),
+      [buffer](auto const& b) { return b.get() == buffer; }
+    );
+    auto events = buffer->events();
+    if (!events.empty()) {
+      retired_events_ += events.size();
+      retired_.push_back({buffer->thread(), std::move(events)});
+      trim_retired();
+    }
+    idle_.push_back(std::move(*it));
+    buffers_.erase(it);
+  }
+
+  // Drops the oldest events of exited threads beyond kMaxRetiredEvents.
+  void trim_retired() {
+    while (kMaxRetiredEvents < retired_events_) {
+      auto& oldest = retired_.front().events;
+      std::size_t excess = retired_events_ - kMaxRetiredEvents;
+
+      if (oldest.size() <= excess) {
+        excess = oldest.size();
+        retired_.pop_front();
+      } else {
+        oldest.erase(
+          oldest.begin(),
+          oldest.begin() + static_cast<std::ptrdiff_t>(excess)
+        );
+      }
+      retired_events_ -= excess;
+      dropped_ += excess;
+    }
+  }
+
+  double relative(std::uint64_t ticks) const noexcept {
+    return ticks > start_ ? static_cast<double>(ticks - start_) : 0.0;
+  }
+
+  static std::string escape(std::string const& s) {
+    std::string result{};
+    result.reserve(s.size());
+    for (char c : s) {
+      if ('"' == c || '\\' == c) {
+        result.push_back('\\');
+      }
+      result.push_back(static_cast<unsigned char>(c) < 0x20 ? ' ' : c);
+    }
+
+    return result;
+  }
+
+  std::atomic<bool> enabled_{false};
+  std::once_flag started_;
+  std::uint64_t start_ = 0;
+  mutable std::mutex mutex_;
+  std::size_t threads_ = 0;
+  std::vector<std::unique_ptr<TraceBuffer>> buffers_;
+  std::vector<std::unique_ptr<TraceBuffer>> idle_;
+  std::deque<ThreadEvents> retired_;
+  std::size_t retired_events_ = 0;
+  std::uint64_t dropped_ = 0;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Stage hook recording the stages that run while the `Tracer` is
+ * enabled.
+ *
+ * Each stage becomes an event named after its callable; with a label, the
+ * hook also records one event spanning from when it was attached to
+ * `result()`.
+ * -------------------------------------------------------------------------- */
+class TraceHook : public StageHook {
+public:
+  TraceHook(char const* label, std::uint64_t begin) noexcept
+    : label_(label), begin_(begin) { }
+
+  template <typename Out, typename S, typename M, typename Next>
+  Out around(std::size_t, S const& s, M&, Next&& next) {
+    auto& tracer = Tracer::instance();
+    if (!tracer.enabled()) {
+      return std::forward<Next>(next)();
+    }
+
+    std::uint64_t begin = CycleClock::now();
+    Out r = std::forward<Next>(next)();
+    tracer.record(begin, CycleClock::now(), trace_name_of(stage_callable(s)));
+
+    return r;
+  }
+
+  template <typename M>
+  void finish(M const&) {
+    auto& tracer = Tracer::instance();
+    if (nullptr != label_ && 0 != begin_ && tracer.enabled()) {
+      tracer.record(begin_, CycleClock::now(), {label_, nullptr, nullptr});
+    }
+  }
+
+private:
+  char const* label_;
+  std::uint64_t begin_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Traces the stages of the pipeline \p value.
+ *
+ * @code
+ * Tracer::instance().enable();
+ * auto r = (with_tracing(create_expensive_e(true), "expensive")
+ *   | transform_expensive_e
+ *   | labeled("accumulate", accumulate_expensive_e)).result();
+ * Tracer::instance().write_json("trace.json");
+ * @endcode
+ *
+ * @param value A `Maybe`/`Either`, or a pipeline started by another
+ * `with_*()` function.
+ * @param label Name of the pipeline event, or nullptr to record stages only.
+ * -------------------------------------------------------------------------- */
+template <typename M>
+auto with_tracing(M&& value, char const* label = nullptr) {
+  return attach_hook(
+    std::forward<M>(value),
+    TraceHook{label, Tracer::instance().enabled() ? CycleClock::now() : 0}
+  );
+}
+
+// End of 'PipelineTrace.h'
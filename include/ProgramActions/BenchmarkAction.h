@@ -0,0 +1,31 @@
+// BenchmarkAction.h
+#pragma once
+
+#include "ProgramAction.h"
+
+// ----------------------------------------------------------------------------
+// BenchmarkAction
+// ----------------------------------------------------------------------------
+//
+// Description: Measures the throughput of registered workloads
+//
+// ----------------------------------------------------------------------------
+class BenchmarkAction : public ProgramAction {
+public:
+  using ExecuteStrategy = std::function<int(
+    BenchmarkAction const&,
+    std::string_view const&
+    )>;
+
+  explicit BenchmarkAction(ExecuteStrategy executor)
+    : executor_(std::move(executor)) { }
+  
+  int execute(std::string_view const& exec_name) const override {
+    return executor_(*this, exec_name);
+  }
+
+private:
+  ExecuteStrategy executor_;
+};
+
+// End of 'BenchmarkAction.h'
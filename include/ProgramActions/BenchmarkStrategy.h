@@ -0,0 +1,96 @@
+// BenchmarkStrategy.h
+#pragma once
+
+#include "BenchmarkAction.h"
+#include "PerfWorkloads.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// BenchmarkStrategy
+// ----------------------------------------------------------------------------
+//
+// Description: Strategy for measuring the throughput of registered
+//              workloads. Each workload is warmed up, then timed over
+//              'repeats' batches of 'iterations' calls; the report gives the
+//              best and median time per call and how much every counter
+//              grew per call
+//
+// ----------------------------------------------------------------------------
+class BenchmarkStrategy {
+public:
+  explicit BenchmarkStrategy(
+    PerfWorkloads workloads,
+    std::size_t iterations = 100000,
+    std::size_t repeats = 5
+    ) : workloads_(std::move(workloads)),
+        iterations_(std::max<std::size_t>(iterations, 1)),
+        repeats_(std::max<std::size_t>(repeats, 1)) { }
+
+  // Runs the workloads and prints the report
+  int operator()(
+      BenchmarkAction const& action,
+      std::string_view const& exec_name
+    ) const {
+    using Clock = std::chrono::steady_clock;
+
+    std::cout
+      << exec_name << ": benchmark, " << repeats_ << " x "
+      << iterations_ << " calls per workload\n"
+      << std::left << std::setw(24) << "workload"
+      << std::right << std::setw(14) << "best ns/call"
+      << std::setw(16) << "median ns/call";
+    for (auto const& counter : workloads_.counters()) {
+      std::cout << std::setw(16) << counter.name + "/call";
+    }
+    std::cout << "\n";
+
+    for (auto const& workload : workloads_.workloads()) {
+      for (std::size_t i = 0; i < iterations_ / 10; ++i) {
+        workload.run();
+      }
+
+      std::vector<double> batches{};
+      auto before = workloads_.sample();
+      for (std::size_t r = 0; r < repeats_; ++r) {
+        auto start = Clock::now();
+        for (std::size_t i = 0; i < iterations_; ++i) {
+          workload.run();
+        }
+        batches.push_back(
+          std::chrono::duration<double, std::nano>(Clock::now() - start)
+            .count() / iterations_
+          );
+      }
+      auto after = workloads_.sample();
+      std::sort(batches.begin(), batches.end());
+
+      std::cout
+        << std::left << std::setw(24) << workload.name
+        << std::right << std::fixed << std::setprecision(1)
+        << std::setw(14) << batches.front()
+        << std::setw(16) << batches[batches.size() / 2]
+        << std::setprecision(3);
+      for (std::size_t c = 0; c < after.size(); ++c) {
+        std::cout << std::setw(16)
+          << static_cast<double>(after[c] - before[c])
+            / (repeats_ * iterations_);
+      }
+      std::cout << std::defaultfloat << "\n";
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+private:
+  PerfWorkloads workloads_;
+  std::size_t iterations_;
+  std::size_t repeats_;
+};
+
+// End of 'BenchmarkStrategy.h'
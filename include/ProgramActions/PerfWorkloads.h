@@ -0,0 +1,67 @@
+// PerfWorkloads.h
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// PerfWorkloads
+// ----------------------------------------------------------------------------
+//
+// Description: Workloads measured by the benchmark and profile strategies,
+//              and the counters sampled around them. A counter is any
+//              monotonic count the program keeps (allocations, copies, ...);
+//              reports show how much it grew per workload call.
+//
+// ----------------------------------------------------------------------------
+class PerfWorkloads {
+public:
+  struct Workload {
+    std::string name;
+    std::function<void()> run;
+  };
+
+  struct Counter {
+    std::string name;
+    std::function<std::uint64_t()> read;
+  };
+
+  // Registers a workload; 'run' performs a single call of it
+  PerfWorkloads& add_workload(std::string name, std::function<void()> run) {
+    workloads_.push_back({std::move(name), std::move(run)});
+
+    return *this;
+  }
+
+  // Registers a counter sampled before and after each workload
+  PerfWorkloads& add_counter(
+      std::string name,
+      std::function<std::uint64_t()> read
+    ) {
+    counters_.push_back({std::move(name), std::move(read)});
+
+    return *this;
+  }
+
+  std::vector<Workload> const& workloads() const { return workloads_; }
+  std::vector<Counter> const& counters() const { return counters_; }
+
+  // Reads all counters
+  std::vector<std::uint64_t> sample() const {
+    std::vector<std::uint64_t> values{};
+    for (auto const& counter : counters_) {
+      values.push_back(counter.read());
+    }
+
+    return values;
+  }
+
+private:
+  std::vector<Workload> workloads_;
+  std::vector<Counter> counters_;
+};
+
+// End of 'PerfWorkloads.h'
@@ -0,0 +1,31 @@
+// ProfileAction.h
+#pragma once
+
+#include "ProgramAction.h"
+
+// ----------------------------------------------------------------------------
+// ProfileAction
+// ----------------------------------------------------------------------------
+//
+// Description: Profiles registered workloads call by call
+//
+// ----------------------------------------------------------------------------
+class ProfileAction : public ProgramAction {
+public:
+  using ExecuteStrategy = std::function<int(
+    ProfileAction const&,
+    std::string_view const&
+    )>;
+
+  explicit ProfileAction(ExecuteStrategy executor)
+    : executor_(std::move(executor)) { }
+  
+  int execute(std::string_view const& exec_name) const override {
+    return executor_(*this, exec_name);
+  }
+
+private:
+  ExecuteStrategy executor_;
+};
+
+// End of 'ProfileAction.h'
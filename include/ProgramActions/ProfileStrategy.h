@@ -0,0 +1,112 @@
+// ProfileStrategy.h
+#pragma once
+
+#include "PerfWorkloads.h"
+#include "ProfileAction.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// ProfileStrategy
+// ----------------------------------------------------------------------------
+//
+// Description: Strategy for profiling registered workloads. Every call is
+//              timed on its own, so the report gives the latency
+//              distribution of a call along with how much every counter
+//              grew per call. The optional start and stop hooks run around
+//              all workloads, e.g. to attach a tracer or a sampling profiler
+//
+// ----------------------------------------------------------------------------
+class ProfileStrategy {
+public:
+  explicit ProfileStrategy(
+    PerfWorkloads workloads,
+    std::size_t iterations = 10000,
+    std::function<void()> on_start = {},
+    std::function<void()> on_stop = {}
+    ) : workloads_(std::move(workloads)),
+        iterations_(std::max<std::size_t>(iterations, 1)),
+        on_start_(std::move(on_start)),
+        on_stop_(std::move(on_stop)) { }
+
+  // Runs the workloads and prints the report
+  int operator()(
+      ProfileAction const& action,
+      std::string_view const& exec_name
+    ) const {
+    using Clock = std::chrono::steady_clock;
+
+    std::cout
+      << exec_name << ": profile, " << iterations_
+      << " calls per workload\n"
+      << std::left << std::setw(24) << "workload"
+      << std::right << std::setw(10) << "mean ns"
+      << std::setw(10) << "p50 ns"
+      << std::setw(10) << "p90 ns"
+      << std::setw(10) << "p99 ns"
+      << std::setw(12) << "max ns";
+    for (auto const& counter : workloads_.counters()) {
+      std::cout << std::setw(16) << counter.name + "/call";
+    }
+    std::cout << "\n";
+
+    if (on_start_) {
+      on_start_();
+    }
+
+    std::vector<double> calls(iterations_);
+    for (auto const& workload : workloads_.workloads()) {
+      auto before = workloads_.sample();
+      for (auto& call : calls) {
+        auto start = Clock::now();
+        workload.run();
+        call = std::chrono::duration<double, std::nano>(Clock::now() - start)
+          .count();
+      }
+      auto after = workloads_.sample();
+
+      double mean
+        = std::accumulate(calls.begin(), calls.end(), 0.0) / calls.size();
+      std::sort(calls.begin(), calls.end());
+      auto percentile = [&calls](double p) {
+        return calls[static_cast<std::size_t>(p * (calls.size() - 1))];
+      };
+
+      std::cout
+        << std::left << std::setw(24) << workload.name
+        << std::right << std::fixed << std::setprecision(1)
+        << std::setw(10) << mean
+        << std::setw(10) << percentile(0.5)
+        << std::setw(10) << percentile(0.9)
+        << std::setw(10) << percentile(0.99)
+        << std::setw(12) << calls.back()
+        << std::setprecision(3);
+      for (std::size_t c = 0; c < after.size(); ++c) {
+        std::cout << std::setw(16)
+          << static_cast<double>(after[c] - before[c]) / iterations_;
+      }
+      std::cout << std::defaultfloat << "\n";
+    }
+
+    if (on_stop_) {
+      on_stop_();
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+private:
+  PerfWorkloads workloads_;
+  std::size_t iterations_;
+  std::function<void()> on_start_;
+  std::function<void()> on_stop_;
+};
+
+// End of 'ProfileStrategy.h'
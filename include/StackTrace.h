@@ -0,0 +1,261 @@
+// ============================================================================
+// Provides optional, lazily symbolized stack traces for Either errors.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * StackTrace.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "FramePool.h"
+#include "StackTraceRef.h"
+#include "Symbols.h"
+
+// Standard library headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include <string>
+#include <utility>
+
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define MAYBE_EITHER_HAS_BACKTRACE 1
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__aarch64__)) \
+  && defined(__linux__)
+#include <pthread.h>
+#define MAYBE_EITHER_HAS_FRAME_WALK 1
+#endif
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+#if defined(MAYBE_EITHER_HAS_FRAME_WALK)
+/** ---------------------------------------------------------------------------
+ * @brief Address range of the calling thread's stack.
+ *
+ * Looked up once per thread; both bounds are zero if the range is unknown.
+ * -------------------------------------------------------------------------- */
+struct StackBounds {
+  std::uintptr_t low = 0;
+  std::uintptr_t high = 0;
+};
+
+inline StackBounds const& thread_stack_bounds() noexcept {
+  thread_local StackBounds const bounds = [] {
+    StackBounds range{};
+    pthread_attr_t attr;
+    if (0 == ::pthread_getattr_np(::pthread_self(), &attr)) {
+      void* low = nullptr;
+      std::size_t size = 0;
+      if (0 == ::pthread_attr_getstack(&attr, &low, &size)) {
+        range.low = reinterpret_cast<std::uintptr_t>(low);
+        range.high = range.low + size;
+      }
+      ::pthread_attr_destroy(&attr);
+    }
+
+    return range;
+  }();
+
+  return bounds;
+}
+#endif
+
+/** ---------------------------------------------------------------------------
+ * @brief Collects up to \p max return addresses of the calling thread by
+ * following the saved frame pointers.
+ *
+ * Only meaningful when the code on the stack keeps frame pointers
+ * (`-fno-omit-frame-pointer`). Every frame is checked to lie further up the
+ * calling thread's stack before it is read, so a frame without a frame
+ * pointer ends the trace early instead of sending the walk astray. Nothing
+ * is collected when the stack range is unknown.
+ *
+ * @return The number of addresses stored in \p frames.
+ * -------------------------------------------------------------------------- */
+#if defined(__GNUC__)
+__attribute__((noinline))
+#endif
+inline std::size_t walk_frame_pointers(void** frames, std::size_t max) {
+  std::size_t depth = 0;
+#if defined(MAYBE_EITHER_HAS_FRAME_WALK)
+  // Each frame starts with the caller's frame pointer followed by the
+  // return address into the caller.
+  auto fp = reinterpret_cast<std::uintptr_t>(__builtin_frame_address(0));
+  StackBounds const& stack = thread_stack_bounds();
+  constexpr std::uintptr_t kFrameRecord = 2 * sizeof(void*);
+
+  while (depth < max && stack.low <= fp && fp + kFrameRecord <= stack.high
+    && 0 == fp % alignof(void*)) {
+    auto* frame = reinterpret_cast<void**>(fp);
+    if (nullptr == frame[1]) {
+      break;
+    }
+    frames[depth++] = frame[1];
+
+    auto next = reinterpret_cast<std::uintptr_t>(frame[0]);
+    if (next <= fp) {
+      break;
+    }
+    fp = next;
+  }
+#else
+  (void)frames;
+  (void)max;
+#endif
+
+  return depth;
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Collects up to \p max return addresses of the calling thread with
+ * the unwinder behind `backtrace()`; works without frame pointers.
+ * @return The number of addresses stored in \p frames.
+ * -------------------------------------------------------------------------- */
+inline std::size_t unwind_frames(void** frames, std::size_t max) {
+#if defined(MAYBE_EITHER_HAS_BACKTRACE)
+  int depth = ::backtrace(frames, static_cast<int>(max));
+
+  return 0 < depth ? static_cast<std::size_t>(depth) : 0;
+#else
+  (void)frames;
+  (void)max;
+
+  return 0;
+#endif
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Return addresses captured when an error was created.
+ *
+ * Nothing is symbolized at capture time; `format()` looks the addresses up
+ * when the trace is printed. Traces are immutable and reference counted, so
+ * copies of an error share one trace. They are allocated from the capturing
+ * thread's `FramePool`.
+ * -------------------------------------------------------------------------- */
+class StackTrace {
+public:
+  static constexpr std::size_t kMaxFrames = 32;
+
+  StackTrace(StackTrace const&) = delete;
+  StackTrace& operator=(StackTrace const&) = delete;
+
+  /** -------------------------------------------------------------------------
+   * @brief Captures the calling thread's stack.
+   *
+   * Walks the frame pointers when `MAYBE_EITHER_FRAME_POINTERS` is defined,
+   * which the build does together with `-fno-omit-frame-pointer`, and uses
+   * `backtrace()` otherwise or when the walk finds nothing.
+   *
+   * @return A trace holding one reference.
+   * ------------------------------------------------------------------------ */
+  static StackTrace* capture() {
+    void* memory = FramePool::allocate(sizeof(StackTrace));
+    auto* trace = ::new (memory) StackTrace{};
+#if defined(MAYBE_EITHER_FRAME_POINTERS) && defined(MAYBE_EITHER_HAS_FRAME_WALK)
+    trace->depth_ = walk_frame_pointers(trace->frames_, kMaxFrames);
+#endif
+    if (0 == trace->depth_) {
+      trace->depth_ = unwind_frames(trace->frames_, kMaxFrames);
+    }
+
+    return trace;
+  }
+
+  void acquire() noexcept {
+    refs_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  static void release(StackTrace* trace) noexcept {
+    if (nullptr != trace
+      && 1 == trace->refs_.fetch_sub(1, std::memory_order_acq_rel)) {
+      trace->~StackTrace();
+      FramePool::deallocate(trace, sizeof(StackTrace));
+    }
+  }
+
+  std::size_t depth() const noexcept { return depth_; }
+
+  void const* frame(std::size_t index) const noexcept {
+    return frames_[index];
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Symbolizes the trace, one "#N address name" line per frame.
+   * ------------------------------------------------------------------------ */
+  std::string format() const {
+    std::string text{};
+    for (std::size_t i = 0; i < depth_; ++i) {
+      char prefix[2 * sizeof(void*) + 16];
+      std::snprintf(prefix, sizeof(prefix), "#%zu %p ", i, frames_[i]);
+
+      // Return addresses point past the call; step back into it.
+      text += prefix;
+      text += symbol_name(static_cast<char const*>(frames_[i]) - 1);
+      text += '\n';
+    }
+
+    return text;
+  }
+
+private:
+  StackTrace() = default;
+  ~StackTrace() = default;
+
+  std::atomic<std::size_t> refs_{1};
+  std::size_t depth_ = 0;
+  void* frames_[kMaxFrames];
+};
+
+#if defined(MAYBE_EITHER_STACK_TRACES)
+/** ---------------------------------------------------------------------------
+ * @brief Installs the stack trace hooks while the program starts, so every
+ * error created from then on captures a trace (see `StackTraceHooks`).
+ * -------------------------------------------------------------------------- */
+inline bool const stack_traces_installed = [] {
+  static constexpr StackTraceHooks hooks{
+    &StackTrace::capture,
+    [](StackTrace* trace) noexcept { trace->acquire(); },
+    &StackTrace::release
+  };
+  stack_trace_hooks.store(&hooks, std::memory_order_release);
+
+  return true;
+}();
+#endif
+
+// End of 'StackTrace.h'
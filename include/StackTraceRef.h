@@ -0,0 +1,110 @@
+// ============================================================================
+// Provides the handle through which Either errors hold their stack traces.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * StackTraceRef.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <atomic>
+#include <utility>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+class StackTrace;
+
+/** ---------------------------------------------------------------------------
+ * @brief Entry points through which errors capture and share stack traces.
+ *
+ * `StackTrace.h` installs them while the program starts if any of its
+ * translation units is built with `MAYBE_EITHER_STACK_TRACES`; until then
+ * errors carry no trace. Deciding at run time keeps `Err` the same in every
+ * translation unit, so parts of a program may be built with and without
+ * the macro, but traces are then captured by all of them.
+ * -------------------------------------------------------------------------- */
+struct StackTraceHooks {
+  StackTrace* (*capture)();
+  void (*acquire)(StackTrace*) noexcept;
+  void (*release)(StackTrace*) noexcept;
+};
+
+inline std::atomic<StackTraceHooks const*> stack_trace_hooks{nullptr};
+
+/** ---------------------------------------------------------------------------
+ * @brief Owning handle to the stack trace of an error; copies share it.
+ *
+ * A default constructed handle captures the calling thread's stack if the
+ * hooks are installed and stays empty otherwise.
+ * -------------------------------------------------------------------------- */
+class StackTraceRef {
+public:
+  StackTraceRef() : trace_(capture()) { }
+
+  StackTraceRef(StackTraceRef const& other) noexcept : trace_(other.trace_) {
+    if (nullptr != trace_) {
+      hooks()->acquire(trace_);
+    }
+  }
+
+  StackTraceRef(StackTraceRef&& other) noexcept
+    : trace_(std::exchange(other.trace_, nullptr)) { }
+
+  StackTraceRef& operator=(StackTraceRef other) noexcept {
+    std::swap(trace_, other.trace_);
+    return *this;
+  }
+
+  ~StackTraceRef() {
+    if (nullptr != trace_) {
+      hooks()->release(trace_);
+    }
+  }
+
+  StackTrace const* get() const noexcept { return trace_; }
+
+private:
+  static StackTraceHooks const* hooks() noexcept {
+    return stack_trace_hooks.load(std::memory_order_acquire);
+  }
+
+  static StackTrace* capture() {
+    StackTraceHooks const* installed = hooks();
+
+    return nullptr != installed ? installed->capture() : nullptr;
+  }
+
+  StackTrace* trace_;
+};
+
+// End of 'StackTraceRef.h'
@@ -0,0 +1,332 @@
+// ============================================================================
+// Provides time budgets and cost-aware stage scheduling for pipelines.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * StageBudget.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "Either.h"
+#include "Maybe.h"
+#include "StageHooks.h"
+
+// Standard library headers
+#include <chrono>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief What the scheduler did with a stage.
+ * -------------------------------------------------------------------------- */
+enum class StageOutcome {
+  kRan,          ///< The stage was invoked.
+  kSkipped,      ///< Optional stage skipped because the budget was too small.
+  kShortCircuit  ///< Not invoked because an earlier stage failed.
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Budget consumption of a single pipeline stage.
+ * -------------------------------------------------------------------------- */
+struct StageRecord {
+  using Duration = std::chrono::steady_clock::duration;
+
+  char const* name;    ///< Stage name, or nullptr for an unnamed stage.
+  Duration expected;   ///< Cost declared by the stage.
+  Duration consumed;   ///< Time the stage actually took.
+  Duration remaining;  ///< Budget left before the stage was scheduled.
+  StageOutcome outcome;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Time budget shared by the stages of a pipeline.
+ *
+ * The budget starts running when it is constructed. Every stage scheduled
+ * through `with_budget()` appends a `StageRecord`, so after the
+ * pipeline completes `records()` tells where the time went and which stages
+ * were skipped.
+ * -------------------------------------------------------------------------- */
+class TimeBudget {
+public:
+  using Clock = std::chrono::steady_clock;
+  using Duration = Clock::duration;
+
+  /** -------------------------------------------------------------------------
+   * @brief Starts a budget of \p budget from now.
+   * ------------------------------------------------------------------------ */
+  template <typename Rep, typename Period>
+  explicit TimeBudget(std::chrono::duration<Rep, Period> budget)
+    : start_(Clock::now()),
+      deadline_(start_ + std::chrono::duration_cast<Duration>(budget)) { }
+
+  /** -------------------------------------------------------------------------
+   * @brief Time left until the budget runs out; negative once overrun.
+   * ------------------------------------------------------------------------ */
+  Duration remaining() const {
+    return deadline_ - Clock::now();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Time consumed since the budget was started.
+   * ------------------------------------------------------------------------ */
+  Duration elapsed() const {
+    return Clock::now() - start_;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Per-stage consumption in the order the stages were scheduled.
+   * ------------------------------------------------------------------------ */
+  std::vector<StageRecord> const& records() const noexcept {
+    return records_;
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Appends the record of a scheduled stage.
+   * ------------------------------------------------------------------------ */
+  void record(StageRecord r) {
+    records_.push_back(r);
+  }
+
+private:
+  Clock::time_point start_;
+  Clock::time_point deadline_;
+  std::vector<StageRecord> records_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief A pipeline stage annotated with its expected cost.
+ *
+ * Created with `stage()` for stages that must always run and with
+ * `optional_stage()` for stages the scheduler may drop when the budget is
+ * too small to afford them.
+ *
+ * @tparam F The type of the wrapped callable.
+ * @tparam Optional Whether the scheduler may skip the stage.
+ * -------------------------------------------------------------------------- */
+template <typename F, bool Optional>
+struct Stage {
+  F f;
+  char const* name;
+  TimeBudget::Duration cost;
+};
+
+template <typename S>
+struct is_stage : std::false_type { };
+
+template <typename F, bool Optional>
+struct is_stage<Stage<F, Optional>> : std::true_type { };
+
+template <typename S>
+struct is_optional_stage : std::false_type { };
+
+template <typename F>
+struct is_optional_stage<Stage<F, true>> : std::true_type { };
+
+/** ---------------------------------------------------------------------------
+ * @brief Declares a stage that always runs, recording its consumption.
+ *
+ * @param name Name reported in the stage record.
+ * @param cost Expected cost of the stage.
+ * @param f The callable, as accepted by `mbind`.
+ * -------------------------------------------------------------------------- */
+template <typename F, typename Rep, typename Period>
+auto stage(
+  char const* name,
+  std::chrono::duration<Rep, Period> cost,
+  F&& f
+) {
+  return Stage<std::decay_t<F>, false>{
+    std::forward<F>(f),
+    name,
+    std::chrono::duration_cast<TimeBudget::Duration>(cost)
+  };
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Declares a stage that is skipped when less than \p cost of the
+ * budget remains.
+ *
+ * A skipped stage of a `Maybe` pipeline yields Nothing, exactly as if the
+ * stage had failed. In an `Either` pipeline a failure would end the whole
+ * computation, so optional `Either` stages must map a `T` to an
+ * `Either<T>` and a skipped one passes its input through unchanged.
+ *
+ * @param name Name reported in the stage record.
+ * @param cost Expected cost of the stage.
+ * @param f The callable, as accepted by `mbind`.
+ * -------------------------------------------------------------------------- */
+template <typename F, typename Rep, typename Period>
+auto optional_stage(
+  char const* name,
+  std::chrono::duration<Rep, Period> cost,
+  F&& f
+) {
+  return Stage<std::decay_t<F>, true>{
+    std::forward<F>(f),
+    name,
+    std::chrono::duration_cast<TimeBudget::Duration>(cost)
+  };
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief The callable of the stage \p s.
+ * -------------------------------------------------------------------------- */
+template <typename F, bool Optional>
+F& stage_callable(Stage<F, Optional>& s) noexcept {
+  return s.f;
+}
+
+template <typename F, bool Optional>
+F const& stage_callable(Stage<F, Optional> const& s) noexcept {
+  return s.f;
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Stage hook scheduling the stages against a `TimeBudget`.
+ *
+ * Stages declared with `stage()` or `optional_stage()` are scheduled
+ * according to their cost; plain callables are treated as required stages
+ * of unknown cost. The budget must outlive the pipeline.
+ * -------------------------------------------------------------------------- */
+class BudgetHook : public StageHook {
+public:
+  explicit BudgetHook(TimeBudget& budget) noexcept : budget_(&budget) { }
+
+  template <typename Out, typename S, typename M, typename Next>
+  Out around(std::size_t, S const& s, M& input, Next&& next) {
+    auto remaining = budget_->remaining();
+
+    if constexpr (is_optional_stage<S>::value) {
+      if (remaining < s.cost) {
+        budget_->record({
+          s.name,
+          s.cost,
+          TimeBudget::Duration::zero(),
+          remaining,
+          StageOutcome::kSkipped
+        });
+
+        return skipped_result<Out>(input);
+      }
+    }
+
+    auto start = TimeBudget::Clock::now();
+    Out r = std::forward<Next>(next)();
+    budget_->record({
+      name_of(s),
+      cost_of(s),
+      TimeBudget::Clock::now() - start,
+      remaining,
+      StageOutcome::kRan
+    });
+
+    return r;
+  }
+
+  template <typename S>
+  void skipped(std::size_t, S const& s) {
+    budget_->record({
+      name_of(s),
+      cost_of(s),
+      TimeBudget::Duration::zero(),
+      budget_->remaining(),
+      StageOutcome::kShortCircuit
+    });
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief The budget the stages are scheduled against.
+   * ------------------------------------------------------------------------ */
+  TimeBudget& budget() const noexcept { return *budget_; }
+
+private:
+  template <typename S>
+  static char const* name_of(S const& s) noexcept {
+    if constexpr (is_stage<S>::value) {
+      return s.name;
+    } else {
+      return nullptr;
+    }
+  }
+
+  template <typename S>
+  static TimeBudget::Duration cost_of(S const& s) noexcept {
+    if constexpr (is_stage<S>::value) {
+      return s.cost;
+    } else {
+      return TimeBudget::Duration::zero();
+    }
+  }
+
+  // A skipped Maybe stage yields Nothing, a skipped Either stage its input.
+  template <typename Out, typename T>
+  static Out skipped_result(Maybe<T>&) noexcept {
+    return {};
+  }
+
+  template <typename Out, typename T>
+  static Out skipped_result(Either<T>& input) {
+    static_assert(
+      std::is_same_v<Out, Either<T>>,
+      "optional Either stages must return Either of their input type"
+    );
+
+    return std::move(input);
+  }
+
+  TimeBudget* budget_;
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Schedules the stages of the pipeline \p value against \p budget.
+ *
+ * @code
+ * TimeBudget budget{std::chrono::milliseconds{5}};
+ * auto r = (with_budget(lookup(id), budget)
+ *   | stage("parse", 200us, parse)
+ *   | optional_stage("enrich", 3ms, enrich)).result();
+ * @endcode
+ *
+ * @param value A `Maybe`/`Either`, or a pipeline started by another
+ * `with_*()` function.
+ * @param budget The budget to schedule against and record consumption in.
+ * -------------------------------------------------------------------------- */
+template <typename M>
+auto with_budget(M&& value, TimeBudget& budget) {
+  return attach_hook(std::forward<M>(value), BudgetHook{budget});
+}
+
+// End of 'StageBudget.h'
@@ -0,0 +1,273 @@
+// ============================================================================
+// Provides a pipeline carrier that runs its stages through stage hooks.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * StageHooks.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "BranchHint.h"
+#include "Either.h"
+#include "Maybe.h"
+
+// Standard library headers
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Base of the stage hooks, doing nothing at every point.
+ *
+ * A hook is what `with_latency()`, `with_tracing()`, `with_cancellation()`,
+ * `with_budget()` and `with_metrics()` attach to a pipeline. It derives from
+ * this class and hides the members it needs:
+ *
+ * - `around<Out>(index, stage, input, next)` is called for a stage whose
+ *   input succeeded. It runs the stage by calling `next()`, or returns an
+ *   `Out` of its own without calling it to keep the stage from running;
+ * - `skipped(index, stage)` is called for a stage short-circuited by an
+ *   earlier failure;
+ * - `finish(value)` is called with the final value by `result() &&`.
+ *
+ * `index` is the position of the stage in the pipeline and `stage` is what
+ * was piped in, before `stage_callable()` unwraps it.
+ * -------------------------------------------------------------------------- */
+struct StageHook {
+  template <typename Out, typename S, typename M, typename Next>
+  Out around(std::size_t, S const&, M&, Next&& next) {
+    return std::forward<Next>(next)();
+  }
+
+  template <typename S>
+  void skipped(std::size_t, S const&) { }
+
+  template <typename M>
+  void finish(M const&) { }
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief The callable a piped in stage runs.
+ *
+ * Stage wrappers carrying data for a hook (see `Stage` in `StageBudget.h`)
+ * overload this to hand out the wrapped callable.
+ * -------------------------------------------------------------------------- */
+template <typename S>
+S& stage_callable(S& s) noexcept {
+  return s;
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Binds \p f to \p input by reference, sparing `mbind` a copy of
+ * the stage.
+ * -------------------------------------------------------------------------- */
+template <typename T, typename F>
+auto bind_stage(Maybe<T> const& input, F& f) {
+  return mbind<T, F&>(input, f);
+}
+
+template <typename T, typename F>
+auto bind_stage(Either<T> const& input, F& f) {
+  return mbind<T, F&>(input, f);
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief A `Maybe` or `Either` travelling down a pipeline whose stages run
+ * through \p Hooks.
+ *
+ * The hooks nest in the order they were attached: the first one attached
+ * is the outermost, so it sees each stage before the others and may keep
+ * them from seeing it at all. Each `with_*()` function attaches its hook to
+ * a plain `Maybe`/`Either` or to a pipeline that already has hooks, so
+ *
+ * @code
+ * auto r = (with_metrics(with_cancellation(load(id), token), metrics)
+ *   | parse
+ *   | validate).result();
+ * @endcode
+ *
+ * checks `token` before every stage and records the stages that run.
+ *
+ * @tparam M The monadic type currently carried (`Maybe<T>` or `Either<T>`).
+ * @tparam Hooks The attached hooks.
+ * -------------------------------------------------------------------------- */
+template <typename M, typename... Hooks>
+class Instrumented {
+public:
+  Instrumented(
+    M value,
+    std::tuple<Hooks...> hooks,
+    std::size_t stage = 0
+  ) noexcept(
+    std::is_nothrow_move_constructible_v<M>
+      && std::is_nothrow_move_constructible_v<std::tuple<Hooks...>>
+  ) : value_(std::move(value)), hooks_(std::move(hooks)), stage_(stage) { }
+
+  /** -------------------------------------------------------------------------
+   * @brief Constructs the carried value directly from the result of
+   * \p make, avoiding a move of the `Maybe`/`Either` at every stage.
+   *
+   * \p make runs before \p hooks is moved from, so it may still use them.
+   * ------------------------------------------------------------------------ */
+  template <typename G>
+  Instrumented(
+    std::in_place_t,
+    G&& make,
+    std::tuple<Hooks...>& hooks,
+    std::size_t stage
+  ) : value_(std::forward<G>(make)()),
+      hooks_(std::move(hooks)),
+      stage_(stage) { }
+
+  /** -------------------------------------------------------------------------
+   * @brief The carried `Maybe`/`Either`.
+   * ------------------------------------------------------------------------ */
+  M const& result() const& noexcept { return value_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Releases the carried `Maybe`/`Either` at the end of a pipeline,
+   * letting every hook finish.
+   * ------------------------------------------------------------------------ */
+  M result() && {
+    std::apply([this](auto&... h) { (h.finish(value_), ...); }, hooks_);
+    return std::move(value_);
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Attaches \p hook inside the hooks already attached.
+   * ------------------------------------------------------------------------ */
+  template <typename H>
+  Instrumented<M, Hooks..., H> attach(H hook) && {
+    return {
+      std::move(value_),
+      std::tuple_cat(std::move(hooks_), std::tuple<H>{std::move(hook)}),
+      stage_
+    };
+  }
+
+  M& value() noexcept { return value_; }
+  std::tuple<Hooks...>& hooks() noexcept { return hooks_; }
+
+  /** -------------------------------------------------------------------------
+   * @brief Position of the next stage in the pipeline.
+   * ------------------------------------------------------------------------ */
+  std::size_t stage() const noexcept { return stage_; }
+
+private:
+  M value_;
+  std::tuple<Hooks...> hooks_;
+  std::size_t stage_;
+};
+
+template <typename M>
+struct is_instrumented : std::false_type { };
+
+template <typename M, typename... Hooks>
+struct is_instrumented<Instrumented<M, Hooks...>> : std::true_type { };
+
+/** ---------------------------------------------------------------------------
+ * @brief Attaches \p hook to \p value, which is either a plain
+ * `Maybe`/`Either` or an `Instrumented` pipeline.
+ * -------------------------------------------------------------------------- */
+template <typename M, typename H>
+auto attach_hook(M&& value, H hook) {
+  using V = std::decay_t<M>;
+
+  if constexpr (is_instrumented<V>::value) {
+    return V{std::forward<M>(value)}.attach(std::move(hook));
+  } else {
+    return Instrumented<V, H>{
+      std::forward<M>(value),
+      std::tuple<H>{std::move(hook)}
+    };
+  }
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Runs the stage \p f on \p input through the hooks from the
+ * \p I-th one inwards.
+ * -------------------------------------------------------------------------- */
+template <
+  std::size_t I,
+  typename Out,
+  typename Hooks,
+  typename M,
+  typename S,
+  typename F
+>
+Out run_stage_hooks(Hooks& hooks, std::size_t index, M& input, S& s, F& f) {
+  if constexpr (std::tuple_size_v<Hooks> == I) {
+    return bind_stage(input, f);
+  } else {
+    return std::get<I>(hooks).template around<Out>(index, s, input, [&] {
+      return run_stage_hooks<I + 1, Out>(hooks, index, input, s, f);
+    });
+  }
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Pipe operator running the next stage of an instrumented pipeline.
+ *
+ * A stage whose input succeeded runs through the hooks; otherwise each
+ * hook is told it was skipped and the failure is propagated as by `mbind`.
+ * -------------------------------------------------------------------------- */
+template <typename M, typename... Hooks, typename S>
+auto operator|(Instrumented<M, Hooks...>&& p, S&& s) {
+  auto& f = stage_callable(s);
+  using Out = decltype(bind_stage(p.result(), f));
+
+  std::size_t index = p.stage();
+  auto& hooks = p.hooks();
+
+  if (ON_ERROR_PATH(!has_succeeded(p.result()))) {
+    std::apply([&](auto&... h) { (h.skipped(index, s), ...); }, hooks);
+    return Instrumented<Out, Hooks...>{
+      std::in_place,
+      [&] { return bind_stage(p.result(), f); },
+      hooks,
+      index + 1
+    };
+  }
+
+  return Instrumented<Out, Hooks...>{
+    std::in_place,
+    [&] { return run_stage_hooks<0, Out>(hooks, index, p.value(), s, f); },
+    hooks,
+    index + 1
+  };
+}
+
+// End of 'StageHooks.h'
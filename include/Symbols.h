@@ -0,0 +1,96 @@
+// ============================================================================
+// Provides lookup of readable names for symbols and code addresses.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * Symbols.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define MAYBE_EITHER_HAS_CXXABI 1
+#endif
+
+#if __has_include(<dlfcn.h>)
+#include <dlfcn.h>
+#define MAYBE_EITHER_HAS_DLADDR 1
+#endif
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Turns a mangled C++ name into a readable one where the ABI allows.
+ * -------------------------------------------------------------------------- */
+inline std::string demangle(char const* name) {
+#if defined(MAYBE_EITHER_HAS_CXXABI)
+  int status = 0;
+  std::unique_ptr<char, void (*)(void*)> readable{
+    abi::__cxa_demangle(name, nullptr, nullptr, &status),
+    std::free
+  };
+  if (0 == status && readable) {
+    return readable.get();
+  }
+#endif
+
+  return name;
+}
+
+/** ---------------------------------------------------------------------------
+ * @brief Looks up the name of the function at \p address.
+ *
+ * Uses the dynamic symbol table, so functions of an executable are only
+ * found when it exports its symbols (`-rdynamic`, or `ENABLE_EXPORTS` in
+ * CMake). Otherwise the address itself is returned.
+ * -------------------------------------------------------------------------- */
+inline std::string symbol_name(void const* address) {
+#if defined(MAYBE_EITHER_HAS_DLADDR)
+  Dl_info info{};
+  if (0 != dladdr(address, &info) && nullptr != info.dli_sname) {
+    return demangle(info.dli_sname);
+  }
+#endif
+
+  char buffer[2 * sizeof(void*) + 3];
+  std::snprintf(buffer, sizeof(buffer), "%p", address);
+
+  return buffer;
+}
+
+// End of 'Symbols.h'
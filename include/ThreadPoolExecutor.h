@@ -0,0 +1,190 @@
+// ============================================================================
+// Provides simple executors for running monadic computations concurrently.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ThreadPoolExecutor.h: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// Implementation Section
+// ============================================================================
+
+/** ---------------------------------------------------------------------------
+ * @brief Executor running every submitted task immediately on the calling
+ * thread.
+ *
+ * Useful for testing, and as a baseline showing what the concurrent
+ * combinators cost when nothing actually runs in parallel.
+ * -------------------------------------------------------------------------- */
+class InlineExecutor {
+public:
+  /** -------------------------------------------------------------------------
+   * @brief Runs \p task to completion before returning.
+   * @param task The task to run.
+   * ------------------------------------------------------------------------ */
+  void execute(std::function<void()> task) const {
+    task();
+  }
+};
+
+/** ---------------------------------------------------------------------------
+ * @brief Fixed-size pool of worker threads fed from a single FIFO queue.
+ *
+ * Any type exposing `execute(std::function<void()>)` can be used where the
+ * concurrent combinators expect an executor; this is the one the project
+ * ships. Destroying the pool runs all tasks still queued and joins the
+ * workers.
+ *
+ * A task may wait for other tasks of the same pool: the combinators use
+ * `is_worker()` and `run_one()` to keep the waiting worker running queued
+ * tasks, so the tasks it waits for can't be stuck behind it.
+ * -------------------------------------------------------------------------- */
+class ThreadPoolExecutor {
+public:
+  /** -------------------------------------------------------------------------
+   * @brief Starts \p threads worker threads.
+   * @param threads Number of workers; defaults to the hardware concurrency.
+   * ------------------------------------------------------------------------ */
+  explicit ThreadPoolExecutor(
+    std::size_t threads = std::max(1u, std::thread::hardware_concurrency())
+  ) {
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers_.emplace_back([this] { run(); });
+    }
+  }
+
+  ThreadPoolExecutor(ThreadPoolExecutor const&) = delete;
+  ThreadPoolExecutor& operator=(ThreadPoolExecutor const&) = delete;
+
+  /** -------------------------------------------------------------------------
+   * @brief Drains the queue and joins all worker threads.
+   * ------------------------------------------------------------------------ */
+  ~ThreadPoolExecutor() {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      stopping_ = true;
+    }
+    ready_.notify_all();
+
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Queues \p task for execution on one of the workers.
+   * @param task The task to run.
+   * ------------------------------------------------------------------------ */
+  void execute(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      queue_.push_back(std::move(task));
+    }
+    ready_.notify_one();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Number of worker threads in the pool.
+   * ------------------------------------------------------------------------ */
+  std::size_t size() const noexcept {
+    return workers_.size();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Checks whether the calling thread is one of this pool's workers.
+   * ------------------------------------------------------------------------ */
+  bool is_worker() const noexcept {
+    return this == current();
+  }
+
+  /** -------------------------------------------------------------------------
+   * @brief Runs the oldest queued task on the calling thread.
+   * @return false if the queue was empty.
+   * ------------------------------------------------------------------------ */
+  bool run_one() {
+    std::function<void()> task;
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      if (queue_.empty()) {
+        return false;
+      }
+      task = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    task();
+
+    return true;
+  }
+
+private:
+  static ThreadPoolExecutor const*& current() noexcept {
+    thread_local ThreadPoolExecutor const* pool = nullptr;
+    return pool;
+  }
+
+  void run() {
+    current() = this;
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock{mutex_};
+        ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+        if (queue_.empty()) {
+          return;
+        }
+        task = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<std::function<void()>> queue_;
+  bool stopping_ = false;
+  std::vector<std::thread> workers_;
+};
+
+// End of 'ThreadPoolExecutor.h'
@@ -95,7 +95,7 @@ Either<ExpensiveToCopy> create_expensive_e(bool success)
   if (success) {
     return ExpensiveToCopy{};
   } else {
-    return FailedToCreate{};
+    return MAKE_ERROR(FailedToCreate{});
   }
 }
 
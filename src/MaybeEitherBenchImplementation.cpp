@@ -0,0 +1,321 @@
+// ============================================================================
+// Benchmark mode of the demo app definition.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+// 
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+// 
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MaybeEitherBenchImplementation.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#if defined(MAYBE_EITHER_COUNT_ALLOCATIONS)
+#include "CountingNew.h"  // The demo counts its allocations
+#endif
+#include "Either.h"
+#include "LatencyHistogram.h"
+#include "Maybe.h"
+#include "MaybeEitherBenchImplementation.h"
+
+// Standard library headers
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// Benchmark Workload Section
+// ============================================================================
+
+// Payload copies made by the stages of the calling thread.
+static thread_local std::uint64_t payload_copies = 0;
+
+// The value passed down a benchmark chain. 'fails_in' counts the stages
+// left until the one that fails; it never reaches zero in chains that
+// succeed.
+struct BenchPayload {
+  std::string bytes;
+  std::size_t fails_in;
+};
+
+class StageFailed : public Err {
+public:
+  explicit StageFailed() : Err{"Benchmark stage failed"} { };
+};
+
+static BenchPayload next_payload(BenchPayload const& payload) {
+  BenchPayload next{payload.bytes, payload.fails_in - 1};
+  ++payload_copies;
+  if (!next.bytes.empty()) {
+    ++next.bytes[0];
+  }
+
+  return next;
+}
+
+static Maybe<BenchPayload> maybe_stage(BenchPayload const& payload) {
+  if (0 == payload.fails_in) {
+    return std::nullopt;
+  }
+
+  return next_payload(payload);
+}
+
+static Either<BenchPayload> either_stage(BenchPayload const& payload) {
+  if (0 == payload.fails_in) {
+    return StageFailed{};
+  }
+
+  return next_payload(payload);
+}
+
+static bool failed(Maybe<BenchPayload> const& result) {
+  return !result;
+}
+
+static bool failed(Either<BenchPayload> const& result) {
+  return 0 != result.index();
+}
+
+// Small, fast generator; each thread gets its own sequence.
+class XorShift {
+public:
+  explicit XorShift(std::uint64_t seed) : state_(seed | 1) { }
+
+  std::uint64_t next() {
+    state_ ^= state_ << 13;
+    state_ ^= state_ >> 7;
+    state_ ^= state_ << 17;
+
+    return state_;
+  }
+
+  double uniform() {
+    return static_cast<double>(next() >> 11) * 0x1.0p-53;
+  }
+
+private:
+  std::uint64_t state_;
+};
+
+// Runs one chain of monad 'M', failing it at a random stage with the
+// configured probability. Returns whether the chain failed.
+template <typename M, typename Stage>
+bool run_chain(BenchConfig const& config, Stage stage, XorShift& random) {
+  std::size_t fails_in = random.uniform() < config.error_rate
+    ? random.next() % config.chain_length
+    : config.chain_length;
+
+  M result{BenchPayload{std::string(config.payload_bytes, 'x'), fails_in}};
+  for (std::size_t s = 0; s < config.chain_length; ++s) {
+    result = std::move(result) | stage;
+  }
+
+  return failed(result);
+}
+
+// Outcome of running one monad's chains on all threads.
+struct BenchRun {
+  double seconds;
+  std::size_t failures;
+};
+
+// Runs the chains of monad 'M' and records their latency as 'stage' of
+// 'latency'.
+template <typename M, typename Stage>
+BenchRun run_chains(
+  BenchConfig const& config,
+  Stage stage,
+  LatencyHistograms& latency,
+  std::size_t index
+) {
+  std::vector<std::size_t> failures(config.threads, 0);
+  std::vector<std::thread> threads{};
+
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t t = 0; t < config.threads; ++t) {
+    std::size_t chains = config.iterations / config.threads
+      + (t < config.iterations % config.threads ? 1 : 0);
+
+    threads.emplace_back([&, t, chains] {
+      XorShift random{0x9E3779B97F4A7C15ull * (t + 1)};
+      std::size_t failed_chains = 0;
+
+      for (std::size_t i = 0; i < chains; ++i) {
+        std::uint64_t began = CycleClock::now();
+        bool chain_failed = run_chain<M>(config, stage, random);
+        latency.record(index, CycleClock::now() - began);
+
+        failed_chains += chain_failed ? 1 : 0;
+      }
+
+      failures[t] = failed_chains;
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  BenchRun run{
+    std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start
+    ).count(),
+    0
+  };
+  for (auto f : failures) {
+    run.failures += f;
+  }
+
+  return run;
+}
+
+static void print_run(
+  BenchConfig const& config,
+  StageLatency const& latency,
+  BenchRun const& run
+) {
+  double chains = static_cast<double>(config.iterations) / run.seconds;
+
+  std::printf(
+    "%-8s %12.0f %12.0f %8zu %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+    latency.name.c_str(),
+    chains,
+    chains * config.chain_length,
+    run.failures,
+    latency.mean,
+    latency.p50,
+    latency.p99,
+    latency.p999,
+    latency.max
+  );
+}
+
+// ============================================================================
+// Function Implementation Section
+// ============================================================================
+
+bool valid_bench_config(BenchConfig const& config)
+{
+  return 0 != config.iterations
+    && 0 != config.threads
+    && 0 != config.chain_length
+    && 0.0 <= config.error_rate
+    && 1.0 >= config.error_rate;
+}
+
+PerfWorkloads bench_workloads(BenchConfig const& config)
+{
+  auto random = std::make_shared<XorShift>(0x9E3779B97F4A7C15ull);
+
+  PerfWorkloads workloads{};
+  workloads
+    .add_workload("Maybe chain", [config, random] {
+      run_chain<Maybe<BenchPayload>>(config, maybe_stage, *random);
+    })
+    .add_workload("Either chain", [config, random] {
+      run_chain<Either<BenchPayload>>(config, either_stage, *random);
+    })
+    .add_counter("copies", [] { return payload_copies; });
+#if defined(MAYBE_EITHER_COUNT_ALLOCATIONS)
+  workloads
+    .add_counter("allocs", [] {
+      return AllocationCounters::instance().count();
+    })
+    .add_counter("bytes", [] {
+      return AllocationCounters::instance().bytes();
+    });
+#endif
+
+  return workloads;
+}
+
+// ============================================================================
+// Class Implementation Section
+// ============================================================================
+
+int
+MaybeEitherBenchImplementation::operator()(
+  BenchmarkAction const& action,
+  std::string_view const& exec_name
+) const
+{
+  if (!valid_bench_config(m_Config)) {
+    std::cerr << exec_name << ": Invalid benchmark parameters: iterations, "
+      "threads and chain length must be positive, error rate within [0, 1]\n";
+
+    return EXIT_FAILURE;
+  }
+
+  LatencyHistograms latency{{"Maybe", "Either"}};
+  auto maybe = run_chains<Maybe<BenchPayload>>(
+    m_Config,
+    maybe_stage,
+    latency,
+    0
+  );
+  auto either = run_chains<Either<BenchPayload>>(
+    m_Config,
+    either_stage,
+    latency,
+    1
+  );
+  auto stages = latency.snapshot();
+
+  std::printf(
+    "%.*s: %zu chains of %zu stages, %zu byte payload, error rate %g, "
+    "%zu thread(s)\n",
+    static_cast<int>(exec_name.size()),
+    exec_name.data(),
+    m_Config.iterations,
+    m_Config.chain_length,
+    m_Config.payload_bytes,
+    m_Config.error_rate,
+    m_Config.threads
+  );
+  std::printf(
+    "%-8s %12s %12s %8s %10s %10s %10s %10s %10s\n",
+    "monad",
+    "chains/s",
+    "binds/s",
+    "failed",
+    "mean ns",
+    "p50 ns",
+    "p99 ns",
+    "p99.9 ns",
+    "max ns"
+  );
+  print_run(m_Config, stages[0], maybe);
+  print_run(m_Config, stages[1], either);
+
+  return EXIT_SUCCESS;
+}
+
+// End of 'MaybeEitherBenchImplementation.cpp'
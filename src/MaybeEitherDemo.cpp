@@ -36,10 +36,12 @@
 #include <MaybeEitherDemo.h>
 
 // Project library headers
+#include <ProgramActions/ProfileStrategy.h>
 #include <ProgramActions/ShowHelpClippStrategy.h>
 #include <ProgramActions/ShowUsageClippStrategy.h>
 #include <ProgramActions/ShowVersionInfoStrategy.h>
 #include <ProgramActions/UnsupportedOptionsClippStrategy.h>
+#include "MaybeEitherBenchImplementation.h"
 #include "MaybeEitherDemoImplementation.h"
 
 // Standard library headers
@@ -73,6 +75,15 @@ int main(int argc, char *argv[])
     // Parse command line options
     auto result = clipp::parse(argc, argv, appOptions);
 
+    // Parameters of the benchmark and profile modes
+    BenchConfig const benchConfig {
+        userOptionValues.m_Iterations,
+        userOptionValues.m_Threads,
+        userOptionValues.m_ChainLength,
+        userOptionValues.m_PayloadBytes,
+        userOptionValues.m_ErrorRate
+    };
+
     // Reference to a program action that will be executed
     std::unique_ptr<ProgramAction> programAction;
 
@@ -120,11 +131,34 @@ int main(int argc, char *argv[])
             )
         );
     }
+    else if (userOptionValues.m_Bench)
+    {
+        // Benchmark the chains instead of running the demos.
+        programAction = std::make_unique<BenchmarkAction> (
+            MaybeEitherBenchImplementation(benchConfig)
+        );
+    }
+    else if (userOptionValues.m_Profile)
+    {
+        // Profile single chains instead of running the demos.
+        if (!valid_bench_config(benchConfig))
+        {
+            std::cerr << execName << ": Invalid benchmark parameters\n";
+
+            return EXIT_FAILURE;
+        }
+        programAction = std::make_unique<ProfileAction> (
+            ProfileStrategy(
+                bench_workloads(benchConfig),
+                userOptionValues.m_Iterations
+            )
+        );
+    }
     else
     {
         // No high priority switch was passed. Proceed with the main code.
         programAction = std::make_unique<MainProgramAction> (
-            MaybeEitherDemoImplementation()
+            MaybeEitherDemoImplementation(userOptionValues.m_TraceFile)
         );
     }
 
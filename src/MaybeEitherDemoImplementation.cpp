@@ -36,6 +36,7 @@
 #include "ExpensiveToCopy.h"
 #include "Either.h"
 #include "MaybeEitherDemoImplementation.h"
+#include "PipelineTrace.h"
 
 #include <variant>
 
@@ -107,6 +108,10 @@ MaybeEitherDemoImplementation::operator()(
   print_maybe<int>(result6);
   std::cout << "\n";
 
+  if (!m_TraceFile.empty()) {
+    Tracer::instance().enable();
+  }
+
   std::cout << exec_name << ": Either type demo: \n";
   std::cout
     << exec_name
@@ -165,6 +170,24 @@ MaybeEitherDemoImplementation::operator()(
   std::visit(PrintResult<int>(), result12);
   std::cout << "\n";
 
+  if (!m_TraceFile.empty()) {
+    std::cout << exec_name << ": Tracing the chained operations ...\n";
+    auto result13 = (with_tracing(create_expensive_e(true), "either chain")
+      | transform_expensive_e
+      | labeled("accumulate", accumulate_expensive_e)).result();
+    std::cout << exec_name << ": ";
+    std::visit(PrintResult<int>(), result13);
+    std::cout << "\n";
+
+    Tracer::instance().enable(false);
+    if (!Tracer::instance().write_json(m_TraceFile)) {
+      std::cerr << exec_name << ": Could not write the trace to '"
+        << m_TraceFile << "'\n";
+      return EXIT_FAILURE;
+    }
+    std::cout << exec_name << ": Trace written to '" << m_TraceFile << "'\n";
+  }
+
   return EXIT_SUCCESS;
 }
 
@@ -0,0 +1,244 @@
+// ============================================================================
+// Unit tests for the adaptive pipeline evaluation using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestAdaptiveEvaluation.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "AdaptiveEvaluation.h" // Include the adaptive evaluation header
+
+// Standard library headers
+#include <thread>
+#include <utility>
+#include <vector>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+Maybe<int> positiveM(int a) {
+  return 0 < a ? Maybe<int>{a} : Maybe<int>{};
+}
+
+Maybe<int> halveM(int a) {
+  return 0 == a % 2 ? Maybe<int>{a / 2} : Maybe<int>{};
+}
+
+Either<int> positiveE(int a) {
+  if (0 >= a) {
+    return Err{"Not positive"};
+  }
+
+  return a;
+}
+
+Either<int> halveE(int a) {
+  if (0 != a % 2) {
+    return Err{"Odd"};
+  }
+
+  return a / 2;
+}
+
+// Records one in every sample and decides every 100 samples.
+AdaptiveOptions const kEager{1, 100, 0.15, 0.05};
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Results
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that adaptive pipelines produce the same results as
+//              `mbind` in both evaluation modes.
+//
+// ----------------------------------------------------------------------------
+TEST(AdaptiveEvaluationTest, Results) {
+  AdaptiveSelector selector{"results", kEager};
+
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int in = -4; in <= 96; ++in) {
+      EXPECT_EQ(
+        Maybe<int>{in} | positiveM | halveM | halveM,
+        run_adaptive(selector, Maybe<int>{in}, [](auto m) {
+          return std::move(m) | positiveM | halveM | halveM;
+        })
+      );
+
+      EXPECT_EQ(
+        (Maybe<int>{in} | positiveM | halveM).value_or(-1),
+        run_adaptive_or(selector, Maybe<int>{in}, -1, [](auto m) {
+          return std::move(m) | positiveM | halveM;
+        })
+      );
+
+      auto expected = Either<int>{in} | positiveE | halveE;
+      auto actual = run_adaptive(selector, Either<int>{in}, [](auto e) {
+        return std::move(e) | positiveE | halveE;
+      });
+      ASSERT_EQ(expected.index(), actual.index());
+      if (0 == expected.index()) {
+        EXPECT_EQ(std::get<int>(expected), std::get<int>(actual));
+      } else {
+        EXPECT_STREQ(
+          std::get<Err>(expected).what(),
+          std::get<Err>(actual).what()
+        );
+      }
+    }
+
+    // Failures are frequent, so the second pass runs branchless.
+    EXPECT_EQ(EvaluationMode::kBranchless, selector.mode());
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Switching
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the selector switches to branchless evaluation
+//              while failures are frequent, back once they are rare, and
+//              reports each switch to its listener.
+//
+// ----------------------------------------------------------------------------
+TEST(AdaptiveEvaluationTest, Switching) {
+  AdaptiveSelector selector{"switching", kEager};
+  std::vector<ModeSwitch> switches{};
+  selector.on_switch([&switches](ModeSwitch const& s) {
+    switches.push_back(s);
+  });
+
+  auto run = [&selector](int n, int fail_every) {
+    for (int i = 0; i < n; ++i) {
+      int in = 0 == i % fail_every ? -1 : i + 1;
+      (void)run_adaptive(selector, Maybe<int>{in}, [](auto m) {
+        return std::move(m) | positiveM;
+      });
+    }
+  };
+
+  run(300, 1000);
+  EXPECT_EQ(EvaluationMode::kBranchy, selector.mode());
+
+  // A failure rate of 10% sits between the thresholds and changes nothing.
+  run(300, 10);
+  EXPECT_EQ(EvaluationMode::kBranchy, selector.mode());
+
+  run(300, 2);
+  EXPECT_EQ(EvaluationMode::kBranchless, selector.mode());
+
+  run(300, 10);
+  EXPECT_EQ(EvaluationMode::kBranchless, selector.mode());
+
+  run(300, 1000);
+  EXPECT_EQ(EvaluationMode::kBranchy, selector.mode());
+
+  ASSERT_EQ(2u, switches.size());
+  EXPECT_STREQ("switching", switches[0].name);
+  EXPECT_EQ(EvaluationMode::kBranchy, switches[0].from);
+  EXPECT_EQ(EvaluationMode::kBranchless, switches[0].to);
+  EXPECT_DOUBLE_EQ(0.5, switches[0].failure_rate);
+  EXPECT_EQ(7u, switches[0].window);
+  EXPECT_EQ(EvaluationMode::kBranchless, switches[1].from);
+  EXPECT_EQ(EvaluationMode::kBranchy, switches[1].to);
+  EXPECT_EQ(13u, switches[1].window);
+
+  auto snapshot = selector.snapshot();
+  EXPECT_EQ(15u, snapshot.windows);
+  EXPECT_EQ(2u, snapshot.switches);
+  EXPECT_EQ(EvaluationMode::kBranchy, snapshot.mode);
+}
+
+// ----------------------------------------------------------------------------
+// Sampling
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that only one in `sample_every` outcomes is recorded,
+//              also when several threads share the selector.
+//
+// ----------------------------------------------------------------------------
+TEST(AdaptiveEvaluationTest, Sampling) {
+  AdaptiveSelector selector{"sampling", AdaptiveOptions{16, 100, 0.15, 0.05}};
+
+  std::vector<std::thread> threads{};
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&selector] {
+      // Sampling every 16th pipeline sees every other input fail.
+      for (int i = 0; i < 16 * 500; ++i) {
+        (void)run_adaptive(selector, Maybe<int>{i / 16}, [](auto m) {
+          return std::move(m) | halveM;
+        });
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  auto snapshot = selector.snapshot();
+  EXPECT_GE(20u, snapshot.windows);
+  EXPECT_LE(18u, snapshot.windows);
+  EXPECT_EQ(EvaluationMode::kBranchless, snapshot.mode);
+}
+
+// ----------------------------------------------------------------------------
+// SamplingPerSelector
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that a thread counts down to the next sample of each
+//              selector separately, so selectors used in turn are all
+//              sampled.
+//
+// ----------------------------------------------------------------------------
+TEST(AdaptiveEvaluationTest, SamplingPerSelector) {
+  AdaptiveOptions options{2, 10, 0.15, 0.05};
+  AdaptiveSelector first{"first", options};
+  AdaptiveSelector second{"second", options};
+
+  for (int i = 0; i < 2 * 10 * 3; ++i) {
+    first.record(true);
+    second.record(false);
+  }
+
+  EXPECT_EQ(3u, first.snapshot().windows);
+  EXPECT_EQ(0.0, first.snapshot().failure_rate);
+  EXPECT_EQ(3u, second.snapshot().windows);
+  EXPECT_EQ(1.0, second.snapshot().failure_rate);
+}
+
+// End of 'TestAdaptiveEvaluation.cpp'
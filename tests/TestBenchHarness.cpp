@@ -0,0 +1,230 @@
+// ============================================================================
+// Unit tests for the statistical benchmark harness using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestBenchHarness.cpp: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "BenchHarness.h" // Include the benchmark harness header
+#include "CountingNew.h"  // Count the allocations of the benchmarks
+
+// Standard library headers
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Options for quick runs of trivial benchmarks.
+BenchOptions quick_options(std::string filter = {}) {
+  BenchOptions options{};
+  options.warmup_seconds = 0.001;
+  options.sample_seconds = 0.001;
+  options.samples = 20;
+  options.pin = false;
+  options.filter = std::move(filter);
+
+  return options;
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Statistics
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that samples are calibrated to the sample time and that
+//              the summary statistics are ordered consistently.
+//
+// ----------------------------------------------------------------------------
+TEST(BenchHarnessTest, Statistics) {
+  BenchHarness harness{quick_options()};
+
+  int counter = 0;
+  ASSERT_TRUE(harness.run("increment", [&counter] { return ++counter; }));
+  ASSERT_EQ(1u, harness.results().size());
+
+  auto const& r = harness.results().front();
+  EXPECT_EQ("increment", r.name);
+  EXPECT_LT(1000u, r.iterations);
+  EXPECT_EQ(20u, r.samples + r.rejected);
+  EXPECT_LE(r.min, r.median);
+  EXPECT_LE(r.ci_low, r.mean);
+  EXPECT_LE(r.mean, r.ci_high);
+  EXPECT_LE(0.0, r.stddev);
+}
+
+// ----------------------------------------------------------------------------
+// Filter And JSON
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that filtered benchmarks don't run and that the results
+//              are written as JSON.
+//
+// ----------------------------------------------------------------------------
+TEST(BenchHarnessTest, FilterAndJson) {
+  BenchHarness harness{quick_options("Either")};
+
+  EXPECT_FALSE(harness.run("Maybe \"bind\"", [] { }));
+  EXPECT_TRUE(harness.run("Either \"bind\"", [] { }));
+
+  std::ostringstream out{};
+  harness.write_json(out);
+  auto json = out.str();
+
+  EXPECT_EQ(std::string::npos, json.find("Maybe"));
+  EXPECT_NE(std::string::npos, json.find("\"name\": \"Either \\\"bind\\\"\""));
+  EXPECT_NE(std::string::npos, json.find("\"ci_high_ns\": "));
+}
+
+// ----------------------------------------------------------------------------
+// Baseline
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that results read back from JSON keep their timings and
+//              tolerances, and that only slowdowns beyond the confidence
+//              interval and the tolerance count as regressions.
+//
+// ----------------------------------------------------------------------------
+TEST(BenchHarnessTest, Baseline) {
+  std::string path = testing::TempDir() + "bench_harness_test.json";
+  {
+    std::ofstream out{path};
+    out << "{\n  \"context\": {\"reference_ns\": 0},\n  \"benchmarks\": [\n"
+        << "    {\"name\": \"slower\", \"mean_ns\": 0.001, "
+           "\"ci_low_ns\": 0.0009, \"ci_high_ns\": 0.0011},\n"
+        << "    {\"name\": \"\\\"same\\\"\", \"mean_ns\": 1e9, "
+           "\"ci_low_ns\": 1e3, \"ci_high_ns\": 1e12, "
+           "\"tolerance\": 0.5},\n"
+        << "    {\"name\": \"faster\", \"mean_ns\": 1e9, "
+           "\"ci_low_ns\": 1e9, \"ci_high_ns\": 1e9}\n  ]\n}\n";
+  }
+
+  BenchBaseline baseline{};
+  ASSERT_TRUE(BenchBaseline::read(path, baseline));
+  std::remove(path.c_str());
+  EXPECT_FALSE(BenchBaseline::read(path, baseline));
+
+  ASSERT_EQ(3u, baseline.benchmarks.size());
+  EXPECT_DOUBLE_EQ(0.001, baseline.benchmarks["slower"].mean);
+  EXPECT_DOUBLE_EQ(0.5, baseline.benchmarks["\"same\""].tolerance);
+  EXPECT_DOUBLE_EQ(-1.0, baseline.benchmarks["faster"].tolerance);
+
+  BenchHarness harness{quick_options()};
+  for (auto name : {"slower", "\"same\"", "faster", "unknown"}) {
+    harness.run(name, [] { });
+  }
+
+  std::ostringstream out{};
+  EXPECT_EQ(1u, harness.compare(baseline, out));
+
+  auto table = out.str();
+  EXPECT_NE(std::string::npos, table.find("REGRESSED"));
+  EXPECT_NE(table.find("faster"), table.rfind("faster"));
+  EXPECT_NE(std::string::npos, table.find("new"));
+}
+
+// ----------------------------------------------------------------------------
+// Memory
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the allocations per call are counted and that a
+//              benchmark touching a large buffer raises the peak RSS.
+//
+// ----------------------------------------------------------------------------
+TEST(BenchHarnessTest, Memory) {
+  BenchHarness harness{quick_options()};
+
+  harness.run("no allocation", [] { return 1; });
+  harness.run("vector", [] {
+    std::vector<int> v(100);
+    do_not_optimize(v.data());
+    return v.size();
+  });
+  harness.run("large buffer", [] {
+    std::vector<char> v(16u << 20, 1);
+    do_not_optimize(v.data());
+    return v.size();
+  });
+  ASSERT_EQ(3u, harness.results().size());
+
+  auto const& none = harness.results()[0];
+  EXPECT_DOUBLE_EQ(0.0, none.allocations);
+  EXPECT_DOUBLE_EQ(0.0, none.allocated_bytes);
+
+  auto const& vector = harness.results()[1];
+  EXPECT_DOUBLE_EQ(1.0, vector.allocations);
+  EXPECT_DOUBLE_EQ(100.0 * sizeof(int), vector.allocated_bytes);
+
+  auto const& large = harness.results()[2];
+  if (0 <= peak_rss_kb()) {
+    EXPECT_LE(8l << 10, large.peak_rss_kb);
+  }
+
+  std::ostringstream out{};
+  harness.write_json(out);
+  EXPECT_NE(std::string::npos, out.str().find("\"allocations\": 1.000000"));
+
+  // Allocations of other threads are counted, also after the threads exit.
+  auto& allocations = AllocationCounters::instance();
+  std::uint64_t count = allocations.count();
+  std::uint64_t bytes = allocations.bytes();
+  std::vector<std::thread> threads{};
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([] {
+      for (int j = 0; j < 10; ++j) {
+        do_not_optimize(std::make_unique<std::uint64_t>(j).get());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_LE(count + 40, allocations.count());
+  EXPECT_LE(bytes + 40 * sizeof(std::uint64_t), allocations.bytes());
+}
+
+// End of 'TestBenchHarness.cpp'
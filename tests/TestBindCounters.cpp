@@ -0,0 +1,177 @@
+// ============================================================================
+// Unit tests for the per-call-site bind counters using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestBindCounters.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "BindCounters.h" // Include the bind counters header
+
+// Standard library headers
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+Maybe<int> halveM(int a) {
+  if (0 != a % 2) {
+    return {};
+  }
+
+  return a / 2;
+}
+
+Either<int> halveE(int a) {
+  if (0 != a % 2) {
+    return Err{"Odd number"};
+  }
+
+  return a / 2;
+}
+
+// Looks up the merged counts of the site counting the given stage.
+BindSiteSnapshot find_site(std::string const& label) {
+  for (auto const& s : bind_counters()) {
+    if (label == s.label) {
+      return s;
+    }
+  }
+
+  return {nullptr, 0, nullptr, 0, 0, 0};
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Maybe Sites
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that every counted site of a Maybe chain counts its own
+//              Just, Nothing and short-circuited outcomes.
+//
+// ----------------------------------------------------------------------------
+TEST(BindCountersTest, MaybeSites) {
+  for (int a : {8, 4, 6, 3}) {
+    auto r = Maybe<int>{a}
+      | COUNTED(halveM)
+      | COUNTED([](int b) { return halveM(b); });
+    (void)r;
+  }
+
+  auto first = find_site("halveM");
+  ASSERT_NE(nullptr, first.file);
+  EXPECT_EQ(3u, first.succeeded);
+  EXPECT_EQ(1u, first.failed);
+  EXPECT_EQ(0u, first.skipped);
+
+  auto second = find_site("[](int b) { return halveM(b); }");
+  ASSERT_NE(nullptr, second.file);
+  EXPECT_EQ(first.line + 1, second.line);
+  EXPECT_EQ(2u, second.succeeded);
+  EXPECT_EQ(1u, second.failed);
+  EXPECT_EQ(1u, second.skipped);
+
+  // Passed to mbind directly only the stage outcome can be seen.
+  auto direct = mbind(Maybe<int>{2}, COUNTED(&halveM));
+  EXPECT_EQ(1, direct.value());
+  EXPECT_EQ(1u, find_site("&halveM").succeeded);
+}
+
+// ----------------------------------------------------------------------------
+// Either Sites Across Threads
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the counts of an Either site are merged across
+//              threads, including threads that have already exited.
+//
+// ----------------------------------------------------------------------------
+TEST(BindCountersTest, EitherSitesAcrossThreads) {
+  auto work = [](int n) {
+    for (int i = 0; i < n; ++i) {
+      auto r = Either<int>{i} | COUNTED(halveE);
+      (void)r;
+    }
+  };
+
+  std::vector<std::thread> threads{};
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back(work, 1000);
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  work(10);
+
+  auto site = find_site("halveE");
+  EXPECT_EQ(4u * 500u + 5u, site.succeeded);
+  EXPECT_EQ(4u * 500u + 5u, site.failed);
+  EXPECT_EQ(0u, site.skipped);
+}
+
+// ----------------------------------------------------------------------------
+// Site Overflow
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that sites beyond the shard capacity share the "other"
+//              id instead of indexing past the shards.
+//
+// ----------------------------------------------------------------------------
+TEST(BindCountersTest, SiteOverflow) {
+  // The registry keeps pointing at its sites, so they must stay alive.
+  static std::vector<std::unique_ptr<BindSite>> sites{};
+  do {
+    sites.push_back(std::make_unique<BindSite>(__FILE__, __LINE__, "filler"));
+  } while (BindCounterRegistry::kOtherSite != sites.back()->id());
+
+  static BindSite const extra{__FILE__, __LINE__, "extra"};
+  EXPECT_EQ(BindCounterRegistry::kOtherSite, extra.id());
+  sites.back()->count(kBindSucceeded);
+  extra.count(kBindFailed);
+
+  auto other = find_site("other");
+  ASSERT_NE(nullptr, other.file);
+  EXPECT_EQ(1u, other.succeeded);
+  EXPECT_EQ(1u, other.failed);
+  EXPECT_EQ(nullptr, find_site("extra").file);
+}
+
+// End of 'TestBindCounters.cpp'
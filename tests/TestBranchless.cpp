@@ -0,0 +1,211 @@
+// ============================================================================
+// Unit tests for the branchless pipeline evaluation using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestBranchless.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "Branchless.h" // Include the branchless pipelines header
+
+// Standard library headers
+#include <cstdint>
+#include <random>
+#include <string>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+struct Point {
+  float x;
+  float y;
+  std::int16_t tag;
+};
+
+Maybe<int> positiveM(int a) {
+  return 0 < a ? Maybe<int>{a} : Maybe<int>{};
+}
+
+Maybe<int> decrementM(int a) {
+  return a - 1;
+}
+
+Maybe<double> rootM(double a) {
+  return 0.0 <= a ? Maybe<double>{a * 0.5} : Maybe<double>{};
+}
+
+Either<int> positiveE(int a) {
+  if (0 >= a) {
+    return Err{"Not positive"};
+  }
+
+  return a;
+}
+
+Either<int> evenE(int a) {
+  if (0 != a % 2) {
+    return Err{"Odd"};
+  }
+
+  return a / 2;
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Select Value
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the branchless selection picks the right operand
+//              for integral, floating-point and aggregate types.
+//
+// ----------------------------------------------------------------------------
+TEST(BranchlessTest, SelectValue) {
+  EXPECT_EQ(-3, select_value(true, -3, 7));
+  EXPECT_EQ(7, select_value(false, -3, 7));
+  EXPECT_TRUE(select_value(true, true, false));
+  EXPECT_FALSE(select_value(false, true, false));
+  EXPECT_DOUBLE_EQ(1.5, select_value(true, 1.5, -2.0));
+  EXPECT_DOUBLE_EQ(-2.0, select_value(false, 1.5, -2.0));
+
+  Point a{1.0f, 2.0f, 3};
+  Point b{4.0f, 5.0f, 6};
+  Point r = select_value(false, a, b);
+  EXPECT_FLOAT_EQ(4.0f, r.x);
+  EXPECT_FLOAT_EQ(5.0f, r.y);
+  EXPECT_EQ(6, r.tag);
+}
+
+// ----------------------------------------------------------------------------
+// Speculative Value
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the payload of a stage result is read correctly,
+//              and that a result holding none reads as a value-initialized
+//              payload.
+//
+// ----------------------------------------------------------------------------
+TEST(BranchlessTest, SpeculativeValue) {
+  Maybe<int> i{42};
+  EXPECT_EQ(42, speculative_value(i));
+
+  Maybe<double> d{-0.25};
+  EXPECT_DOUBLE_EQ(-0.25, speculative_value(d));
+
+  Maybe<Point> p{Point{1.0f, 2.0f, 3}};
+  Point r = speculative_value(p);
+  EXPECT_FLOAT_EQ(1.0f, r.x);
+  EXPECT_FLOAT_EQ(2.0f, r.y);
+  EXPECT_EQ(3, r.tag);
+
+  Maybe<int> none{};
+  EXPECT_EQ(0, speculative_value(none));
+
+  Point q = speculative_value(Maybe<Point>{});
+  EXPECT_FLOAT_EQ(0.0f, q.x);
+  EXPECT_FLOAT_EQ(0.0f, q.y);
+  EXPECT_EQ(0, q.tag);
+
+  EXPECT_EQ(7, speculative_value(Either<int>{7}));
+  EXPECT_EQ(0, speculative_value(Either<int>{Err{"Failed"}}));
+}
+
+// ----------------------------------------------------------------------------
+// Maybe Pipeline
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that branchless Maybe pipelines produce the same
+//              results as the branchy ones for random inputs.
+//
+// ----------------------------------------------------------------------------
+TEST(BranchlessTest, MaybePipeline) {
+  std::mt19937 random{7};
+  std::uniform_int_distribution<int> inputs{-2, 3};
+
+  for (int i = 0; i < 1000; ++i) {
+    Maybe<int> in = inputs(random);
+    if (0 == i % 7) {
+      in.reset();
+    }
+
+    auto expected = Maybe<int>{in} | positiveM | decrementM | positiveM;
+    auto actual = (with_branchless(in)
+      | positiveM
+      | decrementM
+      | positiveM).result();
+    EXPECT_EQ(expected, actual);
+  }
+
+  EXPECT_EQ(1.0, (with_branchless(Maybe<double>{2.0}) | rootM).result());
+  EXPECT_FALSE((with_branchless(Maybe<double>{-2.0}) | rootM).result());
+}
+
+// ----------------------------------------------------------------------------
+// Either Pipeline
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that branchless Either pipelines produce the same
+//              values as the branchy ones and keep the first error.
+//
+// ----------------------------------------------------------------------------
+TEST(BranchlessTest, EitherPipeline) {
+  for (int in = -3; in <= 16; ++in) {
+    auto expected = Either<int>{in} | positiveE | evenE | evenE;
+    auto actual = (with_branchless(Either<int>{in})
+      | positiveE
+      | evenE
+      | evenE).result();
+
+    ASSERT_EQ(expected.index(), actual.index());
+    if (0 == expected.index()) {
+      EXPECT_EQ(std::get<int>(expected), std::get<int>(actual));
+    } else {
+      EXPECT_STREQ(
+        std::get<Err>(expected).what(),
+        std::get<Err>(actual).what()
+      );
+    }
+  }
+
+  auto failed = (with_branchless(Either<int>{Err{"Upstream"}})
+    | positiveE
+    | evenE).result();
+  EXPECT_STREQ("Upstream", std::get<Err>(failed).what());
+}
+
+// End of 'TestBranchless.cpp'
@@ -0,0 +1,192 @@
+// ============================================================================
+// Unit tests for the cooperative cancellation support using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestCancellation.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "Cancellation.h" // Include the cancellation support header
+
+// Standard library headers
+#include <chrono>
+#include <thread>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+using namespace std::chrono_literals;
+
+// Test fixture class 'CancellationTest' that inherits from testing::Test.
+// Provides a source and stages counting how many times they were invoked.
+class CancellationTest : public testing::Test {
+protected:
+  CancellationSource source{};
+  int calls = 0;
+
+  // Stage incrementing its input, optionally cancelling the source.
+  auto incrementM(bool cancel_after = false) {
+    return [this, cancel_after](int a) -> Maybe<int> {
+      ++calls;
+      if (cancel_after) {
+        source.cancel();
+      }
+      return a + 1;
+    };
+  }
+
+  auto incrementE(bool cancel_after = false) {
+    return [this, cancel_after](int a) -> Either<int> {
+      ++calls;
+      if (cancel_after) {
+        source.cancel();
+      }
+      return a + 1;
+    };
+  }
+};
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Tokens
+// ----------------------------------------------------------------------------
+//
+// Description: Tests the state reported by tokens for explicit cancellation
+//              and for deadlines.
+//
+// ----------------------------------------------------------------------------
+TEST_F(CancellationTest, Tokens) {
+  CancellationToken detached{};
+  EXPECT_FALSE(detached.is_cancelled());
+
+  auto token = source.token();
+  EXPECT_FALSE(token.is_cancelled());
+  source.cancel();
+  EXPECT_TRUE(token.is_cancelled());
+  EXPECT_FALSE(token.deadline_passed());
+
+  CancellationSource timed{};
+  timed.cancel_after(10ms);
+  EXPECT_FALSE(timed.token().is_cancelled());
+  std::this_thread::sleep_for(20ms);
+  EXPECT_TRUE(timed.token().is_cancelled());
+  EXPECT_TRUE(timed.token().deadline_passed());
+}
+
+// ----------------------------------------------------------------------------
+// Maybe Pipeline
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that a cancellable Maybe pipeline stops running stages
+//              once cancelled and turns into Nothing.
+//
+// ----------------------------------------------------------------------------
+TEST_F(CancellationTest, MaybePipeline) {
+  auto r1 = (with_cancellation(Maybe<int>{0}, source.token())
+    | incrementM()
+    | incrementM()
+    | incrementM()).result();
+  EXPECT_EQ(3, r1.value());
+  EXPECT_EQ(3, calls);
+
+  calls = 0;
+  auto r2 = (with_cancellation(Maybe<int>{0}, source.token())
+    | incrementM()
+    | incrementM(true)
+    | incrementM()
+    | incrementM()).result();
+  EXPECT_FALSE(r2);
+  EXPECT_EQ(2, calls);
+}
+
+// ----------------------------------------------------------------------------
+// Either Pipeline
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that a cancellable Either pipeline stops running stages
+//              once cancelled or past its deadline, reporting the reason,
+//              and that earlier errors are kept.
+//
+// ----------------------------------------------------------------------------
+TEST_F(CancellationTest, EitherPipeline) {
+  auto r1 = (with_cancellation(Either<int>{0}, source.token())
+    | incrementE()
+    | incrementE(true)
+    | incrementE()).result();
+  EXPECT_TRUE(std::visit(IsLeft<int>(), r1));
+  EXPECT_TRUE(is_cancelled(std::get<Err>(r1)));
+  EXPECT_FALSE(is_deadline_exceeded(std::get<Err>(r1)));
+  EXPECT_EQ(2, calls);
+
+  CancellationSource timed{};
+  timed.set_deadline(std::chrono::steady_clock::now() - 1ms);
+  auto r2 = (with_cancellation(Either<int>{0}, timed.token())
+    | incrementE()).result();
+  EXPECT_TRUE(is_cancelled(std::get<Err>(r2)));
+  EXPECT_TRUE(is_deadline_exceeded(std::get<Err>(r2)));
+
+  auto r3 = (with_cancellation(Either<int>{Err{"Earlier failure"}}, timed.token())
+    | incrementE()).result();
+  EXPECT_STREQ("Earlier failure", std::get<Err>(r3).what());
+  EXPECT_FALSE(is_cancelled(std::get<Err>(r3)));
+}
+
+// ----------------------------------------------------------------------------
+// Deadline Purge
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the deadlines of destroyed sources are purged long
+//              before they expire, while live ones still expire.
+//
+// ----------------------------------------------------------------------------
+TEST_F(CancellationTest, DeadlinePurge) {
+  CancellationSource live{};
+  live.cancel_after(50ms);
+
+  for (int i = 0; i < 1000; ++i) {
+    CancellationSource dropped{};
+    dropped.cancel_after(1h);
+  }
+  EXPECT_GT(100u, DeadlineTimer::instance().pending());
+
+  std::this_thread::sleep_for(100ms);
+  EXPECT_TRUE(live.token().deadline_passed());
+}
+
+// End of 'TestCancellation.cpp'
@@ -0,0 +1,321 @@
+// ============================================================================
+// Unit tests for the concurrent Maybe/Either combinators using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestConcurrent.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "MaybeEitherConcurrent.h" // Include the concurrent combinators header
+#include "ThreadPoolExecutor.h"    // Include the executors header
+
+// Standard library headers
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+using namespace std::chrono_literals;
+
+class LookupFailedErr : public Err {
+public:
+  explicit LookupFailedErr() : Err{"Lookup failed"} {};
+};
+
+// A lookup that succeeds after the given delay.
+auto slowLookup(int value, std::chrono::milliseconds delay) {
+  return [value, delay]() -> Either<int> {
+    std::this_thread::sleep_for(delay);
+    return value;
+  };
+}
+
+// A lookup that fails after the given delay.
+auto failingLookup(std::chrono::milliseconds delay) {
+  return [delay]() -> Either<int> {
+    std::this_thread::sleep_for(delay);
+    return LookupFailedErr{};
+  };
+}
+
+// A lookup that polls its cancellation token until cancelled, counting the
+// cancellations it observed.
+auto cancellableLookup(std::shared_ptr<std::atomic<int>> observed) {
+  return [observed](CancellationToken const& token) -> Either<std::string> {
+    auto deadline = std::chrono::steady_clock::now() + 2s;
+    while (std::chrono::steady_clock::now() < deadline) {
+      if (token.is_cancelled()) {
+        ++*observed;
+        return cancelled_error();
+      }
+      std::this_thread::sleep_for(1ms);
+    }
+
+    return std::string{"not cancelled"};
+  };
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Zip
+// ----------------------------------------------------------------------------
+//
+// Description: Tests combining already evaluated Maybe and Either values into
+//              a tuple, and that the leftmost failure is propagated.
+//
+// ----------------------------------------------------------------------------
+TEST(ConcurrentTest, Zip) {
+  auto m1 = zip(Maybe<int>{1}, Maybe<float>{2.0f}, Maybe<char>{'c'});
+  EXPECT_TRUE(m1);
+  EXPECT_EQ(std::make_tuple(1, 2.0f, 'c'), m1.value());
+
+  auto m2 = zip(Maybe<int>{1}, Maybe<float>{});
+  EXPECT_FALSE(m2);
+
+  auto e1 = zip(Either<int>{1}, Either<float>{2.0f});
+  EXPECT_TRUE(std::visit(IsRight<std::tuple<int, float>>(), e1));
+  EXPECT_EQ(std::make_tuple(1, 2.0f), std::get<0>(e1));
+
+  auto e2 = zip(
+    Either<int>{1},
+    Either<float>{LookupFailedErr{}},
+    Either<char>{cancelled_error()}
+  );
+  EXPECT_TRUE(std::visit(IsLeft<std::tuple<int, float, char>>(), e2));
+  EXPECT_STREQ("Lookup failed", std::get<Err>(e2).what());
+}
+
+// ----------------------------------------------------------------------------
+// When All
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that independent lookups run concurrently, so the total
+//              latency is close to that of the slowest lookup.
+//
+// ----------------------------------------------------------------------------
+TEST(ConcurrentTest, WhenAll) {
+  ThreadPoolExecutor pool{4};
+
+  auto start = std::chrono::steady_clock::now();
+  auto r = when_all(
+    pool,
+    slowLookup(1, 200ms),
+    slowLookup(2, 200ms),
+    slowLookup(3, 200ms),
+    []() -> Either<std::string> { return std::string{"four"}; }
+  );
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  // Running the lookups one after another would take at least 600 ms.
+  EXPECT_TRUE(std::visit(IsRight<std::tuple<int, int, int, std::string>>(), r));
+  EXPECT_EQ(std::make_tuple(1, 2, 3, std::string{"four"}), std::get<0>(r));
+  EXPECT_LT(elapsed, 500ms);
+
+  auto inline_r = when_all(InlineExecutor{}, slowLookup(1, 0ms));
+  EXPECT_EQ(1, std::get<0>(std::get<0>(inline_r)));
+}
+
+// ----------------------------------------------------------------------------
+// When All Failure
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the first failure is returned without waiting for
+//              the siblings, even a slow one that never polls its token, and
+//              that the polling siblings observe the cancellation.
+//
+// ----------------------------------------------------------------------------
+TEST(ConcurrentTest, WhenAllFailure) {
+  ThreadPoolExecutor pool{4};
+  auto observed = std::make_shared<std::atomic<int>>(0);
+
+  auto start = std::chrono::steady_clock::now();
+  auto r = when_all(
+    pool,
+    cancellableLookup(observed),
+    failingLookup(10ms),
+    slowLookup(3, 1500ms)
+  );
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_TRUE(std::visit(IsLeft<std::tuple<std::string, int, int>>(), r));
+  EXPECT_STREQ("Lookup failed", std::get<Err>(r).what());
+  EXPECT_LT(elapsed, 1s);
+
+  // Wait for the cancelled sibling to notice the cancellation.
+  auto deadline = std::chrono::steady_clock::now() + 2s;
+  while (1 > observed->load() && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(1, observed->load());
+}
+
+// ----------------------------------------------------------------------------
+// When All Exceptions
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that an exception thrown by a callable reaches the
+//              caller.
+//
+// ----------------------------------------------------------------------------
+TEST(ConcurrentTest, WhenAllExceptions) {
+  ThreadPoolExecutor pool{2};
+
+  EXPECT_THROW(
+    when_all(
+      pool,
+      slowLookup(1, 10ms),
+      []() -> Either<int> { throw std::logic_error{"broken"}; }
+    ),
+    std::logic_error
+  );
+}
+
+// ----------------------------------------------------------------------------
+// First Of
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the first successful alternative wins without
+//              waiting for the slower ones, which observe the cancellation.
+//
+// ----------------------------------------------------------------------------
+TEST(ConcurrentTest, FirstOf) {
+  ThreadPoolExecutor pool{4};
+  auto observed = std::make_shared<std::atomic<int>>(0);
+
+  // The fast source fails, so the slow, reliable one has to provide the
+  // result. It was started at the same time, so the failure costs nothing;
+  // trying the sources one after another would take at least 1.1 s.
+  auto start = std::chrono::steady_clock::now();
+  auto r1 = first_of(pool, failingLookup(500ms), slowLookup(42, 600ms));
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_EQ(42, std::get<int>(r1));
+  EXPECT_LT(elapsed, 1s);
+
+  // The fast source wins without waiting for the slow one that comes last
+  // and never polls its token.
+  start = std::chrono::steady_clock::now();
+  auto r3 = first_of(pool, slowLookup(1, 10ms), slowLookup(2, 1500ms));
+  elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_EQ(1, std::get<int>(r3));
+  EXPECT_LT(elapsed, 1s);
+
+  // The fast source succeeds and the slow one gets cancelled.
+  auto r2 = first_of(
+    pool,
+    [observed](CancellationToken const& token) -> Maybe<std::string> {
+      while (!token.is_cancelled()) {
+        std::this_thread::sleep_for(1ms);
+      }
+      ++*observed;
+      return {};
+    },
+    []() -> Maybe<std::string> { return std::string{"fast"}; }
+  );
+  EXPECT_EQ("fast", r2.value());
+
+  auto deadline = std::chrono::steady_clock::now() + 2s;
+  while (1 > observed->load() && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(1, observed->load());
+}
+
+// ----------------------------------------------------------------------------
+// First Of Failure
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that a failure is reported only once every alternative
+//              has failed.
+//
+// ----------------------------------------------------------------------------
+TEST(ConcurrentTest, FirstOfFailure) {
+  ThreadPoolExecutor pool{2};
+
+  auto r1 = first_of(pool, failingLookup(10ms), failingLookup(1ms));
+  EXPECT_TRUE(std::visit(IsLeft<int>(), r1));
+  EXPECT_STREQ("Lookup failed", std::get<Err>(r1).what());
+
+  auto r2 = first_of(
+    pool,
+    []() -> Maybe<int> { return {}; },
+    []() -> Maybe<int> { throw std::logic_error{"broken"}; }
+  );
+  EXPECT_FALSE(r2);
+
+  EXPECT_THROW(
+    first_of(
+      pool,
+      []() -> Maybe<int> { throw std::logic_error{"broken"}; },
+      []() -> Maybe<int> { throw std::logic_error{"broken"}; }
+    ),
+    std::logic_error
+  );
+}
+
+// ----------------------------------------------------------------------------
+// Nested On Workers
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that tasks running on a pool can wait on when_all() and
+//              first_of() over the same pool without deadlocking it, even
+//              when it has a single worker.
+//
+// ----------------------------------------------------------------------------
+TEST(ConcurrentTest, NestedOnWorkers) {
+  ThreadPoolExecutor pool{1};
+  EXPECT_FALSE(pool.is_worker());
+
+  auto r = when_all(pool, [&pool]() -> Either<int> {
+    EXPECT_TRUE(pool.is_worker());
+    auto inner = when_all(pool, slowLookup(1, 1ms), slowLookup(2, 1ms));
+    auto first = first_of(pool, failingLookup(1ms), slowLookup(3, 1ms));
+
+    return std::get<0>(std::get<0>(inner)) + std::get<1>(std::get<0>(inner))
+      + std::get<0>(first);
+  });
+
+  ASSERT_TRUE(std::visit(IsRight<std::tuple<int>>(), r));
+  EXPECT_EQ(6, std::get<0>(std::get<0>(r)));
+}
+
+// End of 'TestConcurrent.cpp'
@@ -0,0 +1,251 @@
+// ============================================================================
+// Unit tests for the Maybe/Either coroutine support using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestCoroutine.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "MaybeEitherCoroutine.h" // Include the coroutine support header
+
+// Standard library headers
+#include <cmath> // Include for mathematical functions like std::sqrt
+#include <stdexcept>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+class DivisionByZeroErr : public Err {
+public:
+  explicit DivisionByZeroErr() : Err{"Division by zero"} {};
+};
+
+// Counts how many times a guarded statement following a co_await was reached,
+// so the tests can verify that short-circuiting stops the coroutine body.
+static int reached = 0;
+
+// Tracks live instances to verify locals are destroyed on short-circuit.
+struct Tracked {
+  static int live;
+  Tracked() { ++live; }
+  Tracked(const Tracked&) { ++live; }
+  ~Tracked() { --live; }
+};
+
+int Tracked::live = 0;
+
+auto moduloM(int a) -> Maybe<int> {
+  if (0 == a) {
+    return {};
+  }
+
+  return 42 % a;
+}
+
+auto squareRootM(int a) -> Maybe<float> {
+  if (0 > a) {
+    return {};
+  }
+
+  return std::sqrt(static_cast<float>(a));
+}
+
+auto moduloE(int a) -> Either<int> {
+  if (0 == a) {
+    return DivisionByZeroErr{};
+  }
+
+  return 42 % a;
+}
+
+// Coroutine running 'moduloM' and 'squareRootM' on the same input, both of
+// which have to succeed for the coroutine to produce a value.
+auto chainM(int a) -> MaybeTask<float> {
+  Tracked guard{};
+  int m = co_await moduloM(a);
+  ++reached;
+  float r = co_await squareRootM(a);
+  ++reached;
+  co_return r + m;
+}
+
+// Coroutine adding the values of two Maybes.
+auto sumM(Maybe<int> a, Maybe<int> b) -> MaybeTask<int> {
+  co_return co_await a + co_await b;
+}
+
+// Coroutine awaiting the task of another coroutine.
+auto sumTwiceM(Maybe<int> a, Maybe<int> b) -> MaybeTask<int> {
+  int once = co_await sumM(a, b);
+  co_return once + co_await a + co_await b;
+}
+
+// Coroutine equivalent of 'Either<int>{a} | moduloE | moduloE'.
+auto chainE(int a) -> EitherTask<int> {
+  Tracked guard{};
+  int m = co_await moduloE(a);
+  ++reached;
+  int r = co_await moduloE(m);
+  ++reached;
+  co_return r;
+}
+
+// Coroutine returning an error explicitly.
+auto failE(int a) -> EitherTask<int> {
+  if (0 > a) {
+    co_return DivisionByZeroErr{};
+  }
+
+  co_return co_await moduloE(a);
+}
+
+// Coroutine throwing from its body. The copy of 'frame' lives in the
+// coroutine frame, so it tells whether the frame was released.
+auto throwingM(int a, [[maybe_unused]] Tracked frame = {}) -> MaybeTask<int> {
+  int m = co_await moduloM(a);
+  if (0 == m) {
+    throw std::logic_error{"zero"};
+  }
+
+  co_return m;
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Maybe Coroutines
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that 'co_await' on a Maybe yields the held value and
+//              that an empty Maybe short-circuits the coroutine, destroying
+//              its locals without running the remaining statements.
+//
+// ----------------------------------------------------------------------------
+TEST(CoroutineTest, MaybeCoroutine) {
+  reached = 0;
+  Maybe<float> r1 = chainM(5);
+  EXPECT_TRUE(r1);
+  EXPECT_EQ(std::sqrt(5.0f) + 2.0f, r1.value());
+  EXPECT_EQ(2, reached);
+
+  reached = 0;
+  Maybe<float> r2 = chainM(0);
+  EXPECT_FALSE(r2);
+  EXPECT_EQ(0, reached);
+  EXPECT_EQ(0, Tracked::live);
+
+  reached = 0;
+  Maybe<float> r3 = chainM(-5);
+  EXPECT_FALSE(r3);
+  EXPECT_EQ(1, reached);
+  EXPECT_EQ(0, Tracked::live);
+
+  EXPECT_EQ(5, sumM(2, 3).result().value());
+  EXPECT_FALSE(sumM(2, std::nullopt).result());
+  EXPECT_FALSE(sumM(std::nullopt, 3).result());
+  EXPECT_EQ(10, sumTwiceM(2, 3).result().value());
+  EXPECT_FALSE(sumTwiceM(2, std::nullopt).result());
+}
+
+// ----------------------------------------------------------------------------
+// Either Coroutines
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that 'co_await' on an Either yields the successful value
+//              and that a Left value is propagated as the coroutine result.
+//
+// ----------------------------------------------------------------------------
+TEST(CoroutineTest, EitherCoroutine) {
+  reached = 0;
+  Either<int> r1 = chainE(5);
+  EXPECT_TRUE(std::visit(IsRight<int>(), r1));
+  EXPECT_EQ(0, std::get<int>(r1));
+  EXPECT_EQ(2, reached);
+
+  reached = 0;
+  Either<int> r2 = chainE(0);
+  EXPECT_TRUE(std::visit(IsLeft<int>(), r2));
+  EXPECT_STREQ("Division by zero", std::get<Err>(r2).what());
+  EXPECT_EQ(0, reached);
+  EXPECT_EQ(0, Tracked::live);
+
+  reached = 0;
+  Either<int> r3 = chainE(42);
+  EXPECT_TRUE(std::visit(IsLeft<int>(), r3));
+  EXPECT_EQ(1, reached);
+  EXPECT_EQ(0, Tracked::live);
+
+  Either<int> r4 = failE(-1);
+  EXPECT_STREQ("Division by zero", std::get<Err>(r4).what());
+  EXPECT_EQ(2, std::get<int>(failE(5).result()));
+}
+
+// ----------------------------------------------------------------------------
+// Exceptions
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that exceptions escaping a coroutine body reach the
+//              caller and that the coroutine frame is released.
+//
+// ----------------------------------------------------------------------------
+TEST(CoroutineTest, Exceptions) {
+  EXPECT_THROW(Maybe<int>{throwingM(42)}, std::logic_error);
+  EXPECT_EQ(0, Tracked::live);
+  static_cast<void>(throwingM(42));
+  EXPECT_EQ(0, Tracked::live);
+  EXPECT_EQ(2, throwingM(5).result().value());
+  EXPECT_EQ(0, Tracked::live);
+}
+
+// ----------------------------------------------------------------------------
+// Frame Pool
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the frame pool recycles released blocks.
+//
+// ----------------------------------------------------------------------------
+TEST(CoroutineTest, FramePool) {
+  void* p1 = FramePool::allocate(100);
+  FramePool::deallocate(p1, 100);
+  EXPECT_LE(1u, FramePool::cached(100));
+  void* p2 = FramePool::allocate(120);
+  EXPECT_EQ(p1, p2);
+  FramePool::deallocate(p2, 120);
+}
+
+// End of 'TestCoroutine.cpp'
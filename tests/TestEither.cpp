@@ -37,6 +37,11 @@
 
 // Standard library headers
 #include <cmath> // Include for mathematical functions like std::sqrt
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 // External libraries headers
 #include <gtest/gtest.h>  // GoogleTest framework for unit testing
@@ -97,6 +102,59 @@ auto squareRoot(int a) -> Either<float> {
   return std::sqrt(static_cast<float>(a));
 }
 
+// Constexpr functions validating a port and mapping it to a port range,
+// returning a literal error on invalid input.
+constexpr auto checkedPort(int a) -> LiteralEither<int> {
+  if (0 >= a || 65535 < a) {
+    return LiteralErr{"Port out of range"};
+  }
+
+  return a;
+}
+
+constexpr auto portRange(int a) -> LiteralEither<char> {
+  if (1024 > a) {
+    return LiteralErr{"Privileged port"};
+  }
+
+  return 49152 > a ? 'r' : 'd';
+}
+
+// The error message of 'e', or the empty string if it holds a value.
+template <typename T>
+constexpr std::string_view literalError(LiteralEither<T> const& e) {
+  auto const* err = std::get_if<1>(&e);
+
+  return nullptr != err ? err->what() : "";
+}
+
+// A payload counting how often it is copied and moved.
+struct Tracked {
+  static inline int copies = 0;
+  static inline int moves = 0;
+
+  explicit Tracked(int v) noexcept : value{v} {}
+  Tracked(Tracked const& other) noexcept : value{other.value} { ++copies; }
+  Tracked(Tracked&& other) noexcept : value{other.value} { ++moves; }
+  Tracked& operator=(Tracked const&) = default;
+  Tracked& operator=(Tracked&&) = default;
+
+  int value;
+};
+
+// Stages that can't throw, next to multiplyOne which may.
+auto incrementNothrow(int a) noexcept -> Either<int> {
+  return a + 1;
+}
+
+auto trackNothrow(int a) noexcept -> Either<Tracked> {
+  if (0 == a % 3) {
+    return Err{"Multiple of three"};
+  }
+
+  return Tracked{a};
+}
+
 
 // Test fixture class 'EitherTest' that inherits from testing::Test.
 // This allows setting up common objects and state for multiple test cases.
@@ -304,4 +362,210 @@ TEST_F(EitherTest, PipeOperator) {
   );
 }
 
+// ----------------------------------------------------------------------------
+// Error Origin
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that errors made with MAKE_ERROR carry their call site,
+//              which survives propagation and slicing into Err, and that
+//              other errors have none.
+//
+// ----------------------------------------------------------------------------
+auto checkedModulo(int a) -> Either<int> {
+  if (0 == a) {
+    return MAKE_ERROR(DivisionByZeroErr{});
+  }
+
+  return 42 % a;
+}
+
+TEST_F(EitherTest, ErrorOrigin) {
+  auto r1 = Either<int>{0} | multiplyOne | checkedModulo | multiplyOne;
+  auto r2 = Either<int>{0} | multiplyOne | modulo;
+
+  ASSERT_FALSE(std::visit(IsRight<int>(), r1));
+  ErrorSite const* origin = std::get<Err>(r1).origin();
+  ASSERT_NE(nullptr, origin);
+  EXPECT_NE(std::string::npos, std::string{origin->file}.find("TestEither.cpp"));
+  EXPECT_EQ(0u, site_function(*origin).find("checkedModulo"));
+  EXPECT_EQ(std::string::npos, site_function(*origin).find("lambda"));
+  EXPECT_EQ(0u, describe_site(*origin).find(origin->file));
+
+  ASSERT_FALSE(std::visit(IsRight<int>(), r2));
+  EXPECT_EQ(nullptr, std::get<Err>(r2).origin());
+
+  // Temporaries come back by value rather than as a dangling reference.
+  static constexpr ErrorSite site{__FILE__, __LINE__, __func__};
+  Err lvalue{"Failed"};
+  static_assert(std::is_same_v<Err, decltype(with_origin(site, Err{"Failed"}))>);
+  static_assert(std::is_same_v<Err&, decltype(with_origin(site, lvalue))>);
+  EXPECT_EQ(&site, with_origin(site, Err{"Failed"}).origin());
+
+  // The context, the origin, the kind and the trace take at most four words
+  // on top of std::runtime_error, whether traces are captured or not.
+  EXPECT_GE(
+    sizeof(std::runtime_error) + 4 * sizeof(void*),
+    sizeof(Err)
+  );
+}
+
+// ----------------------------------------------------------------------------
+// Site Function
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the enclosing function is recovered from the
+//              lambda signatures GCC, clang and MSVC give ERROR_SITE().
+//
+// ----------------------------------------------------------------------------
+TEST_F(EitherTest, SiteFunction) {
+  auto function_of = [](char const* signature) {
+    return site_function(ErrorSite{__FILE__, __LINE__, signature});
+  };
+
+  EXPECT_EQ(
+    "checkedModulo(int)",
+    function_of("checkedModulo(int)::<lambda()>")
+  );
+  EXPECT_EQ(
+    "checkedModulo(int)",
+    function_of(
+      "const ErrorSite &checkedModulo(int)::"
+      "(lambda at TestEither.cpp:376:12)::operator()() const"
+    )
+  );
+  EXPECT_EQ(
+    "checkedModulo",
+    function_of(
+      "const struct ErrorSite &__cdecl checkedModulo::"
+      "<lambda_1>::operator ()(void) const"
+    )
+  );
+  EXPECT_EQ("main", function_of("main"));
+}
+
+// ----------------------------------------------------------------------------
+// Propagate Error
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that an error keeps its message and origin when it is
+//              propagated through stages changing the value type, which
+//              compact builds do out of line.
+//
+// ----------------------------------------------------------------------------
+TEST_F(EitherTest, PropagateError) {
+  auto toText = [](int a) -> Either<std::string> {
+    return std::to_string(a);
+  };
+
+  auto r = Either<int>{0} | checkedModulo | toText;
+  ASSERT_EQ(1u, r.index());
+  EXPECT_STREQ("Division by zero", std::get<Err>(r).what());
+  EXPECT_NE(nullptr, std::get<Err>(r).origin());
+
+  auto direct = propagate_error<double>(Err{"Failed"});
+  ASSERT_EQ(1u, direct.index());
+  EXPECT_STREQ("Failed", std::get<Err>(direct).what());
+}
+
+// ----------------------------------------------------------------------------
+// Valueless
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that binding an Either left valueless by an exception
+//              propagates an error instead of throwing, as its noexcept
+//              promises.
+//
+// ----------------------------------------------------------------------------
+TEST_F(EitherTest, Valueless) {
+  struct Throwing {
+    std::string text{};
+
+    Throwing() = default;
+    explicit Throwing(int) { throw std::runtime_error{"Failed"}; }
+  };
+
+  Either<Throwing> e{};
+  EXPECT_THROW(e.emplace<0>(1), std::runtime_error);
+  ASSERT_TRUE(e.valueless_by_exception());
+
+  auto toInt = [](Throwing const&) noexcept -> Either<int> { return 1; };
+  static_assert(noexcept(mbind(e, toInt)));
+
+  auto r = mbind(e, toInt);
+  ASSERT_EQ(1u, r.index());
+  EXPECT_EQ(&valueless_error(), &valueless_error());
+  EXPECT_STREQ(valueless_error().what(), std::get<Err>(r).what());
+}
+
+// ----------------------------------------------------------------------------
+// Constant Evaluation
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that chains of constexpr functions on a LiteralEither are
+//              evaluated at compile time, propagating the first literal error,
+//              and give the same results at run time.
+//
+// ----------------------------------------------------------------------------
+TEST_F(EitherTest, ConstantEvaluation) {
+  static_assert(std::is_trivially_copyable_v<LiteralEither<int>>);
+
+  static_assert('r' == std::get<0>(LiteralEither<int>{8080}
+    | checkedPort
+    | portRange));
+  static_assert(
+    'd' == std::get<0>(mbind(LiteralEither<int>{50000}, portRange))
+  );
+  static_assert("Port out of range" == literalError(LiteralEither<int>{0}
+    | checkedPort
+    | portRange));
+  static_assert("Privileged port" == literalError(LiteralEither<int>{80}
+    | checkedPort
+    | portRange));
+  static_assert("Rejected" == literalError(
+    LiteralEither<int>{LiteralErr{"Rejected"}} | checkedPort
+  ));
+
+  auto r = LiteralEither<int>{70000} | checkedPort | portRange;
+  EXPECT_EQ(1u, r.index());
+  EXPECT_STREQ("Port out of range", std::get<1>(r).what());
+}
+
+// ----------------------------------------------------------------------------
+// Noexcept
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that binds are noexcept exactly when their stages are,
+//              and that a growing vector of results moves rather than copies
+//              its elements.
+//
+// ----------------------------------------------------------------------------
+TEST_F(EitherTest, Noexcept) {
+  static_assert(noexcept(mbind(valid, incrementNothrow)));
+  static_assert(noexcept(Either<int>{1} | incrementNothrow | trackNothrow));
+  auto identity = [](int a) noexcept -> Either<int> { return a; };
+  static_assert(noexcept(Either<int>{1} | identity | std::move(identity)));
+  static_assert(!noexcept(mbind(valid, multiplyOne)));
+  static_assert(!noexcept(Either<int>{1} | incrementNothrow | multiplyOne));
+  static_assert(!noexcept(LiteralEither<int>{8080} | checkedPort));
+  static_assert(std::is_nothrow_move_constructible_v<Either<Tracked>>);
+
+  Tracked::copies = 0;
+  Tracked::moves = 0;
+
+  std::vector<Either<Tracked>> results{};
+  for (int i = 0; i < 100; ++i) {
+    results.push_back(Either<int>{i} | incrementNothrow | trackNothrow);
+  }
+
+  ASSERT_EQ(100u, results.size());
+  EXPECT_EQ(2, std::get<Tracked>(results[1]).value);
+  EXPECT_EQ(1u, results[2].index());
+
+  // Reallocating moves each of the 67 held values once.
+  int moves = Tracked::moves;
+  results.reserve(2 * results.capacity());
+  EXPECT_EQ(moves + 67, Tracked::moves);
+  EXPECT_EQ(0, Tracked::copies);
+}
+
 // End of 'TestEither.cpp'
\ No newline at end of file
@@ -0,0 +1,181 @@
+// ============================================================================
+// Unit tests for the lazy error context chains using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestErrorContext.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "ErrorContext.h" // Include the error context header
+
+// Standard library headers
+#include <string>
+#include <thread>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+class OddNumberErr : public Err {
+public:
+  explicit OddNumberErr() : Err{"Odd number"} {};
+};
+
+Either<int> halveE(int a) {
+  if (0 != a % 2) {
+    return OddNumberErr{};
+  }
+
+  return a / 2;
+}
+
+// Counts formatted frames so tests can tell that formatting is lazy.
+struct Counted {
+  int* formatted;
+};
+
+std::ostream& operator<<(std::ostream& out, Counted const& c) {
+  ++*c.formatted;
+  return out << "counted";
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Success Path
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that context leaves successful values untouched and
+//              never formats anything.
+//
+// ----------------------------------------------------------------------------
+TEST(ErrorContextTest, SuccessPath) {
+  int formatted = 0;
+  auto r = Either<int>{8}
+    | halveE
+    | context("in ", Counted{&formatted})
+    | halveE;
+
+  EXPECT_EQ(2, std::get<int>(r));
+  EXPECT_EQ(0, formatted);
+}
+
+// ----------------------------------------------------------------------------
+// Chain
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that frames accumulate outermost first and are only
+//              formatted when the message is requested.
+//
+// ----------------------------------------------------------------------------
+TEST(ErrorContextTest, Chain) {
+  int formatted = 0;
+  auto r = Either<int>{6}
+    | halveE
+    | halveE
+    | context("in record ", 1234)
+    | halveE
+    | context("while parsing ", Counted{&formatted});
+
+  ASSERT_EQ(1u, r.index());
+  EXPECT_STREQ("Odd number", std::get<Err>(r).what());
+  EXPECT_EQ(0, formatted);
+
+  EXPECT_EQ(
+    "while parsing counted: in record 1234: Odd number",
+    error_message(std::get<Err>(r))
+  );
+  EXPECT_EQ(1, formatted);
+
+  Err plain{"Plain"};
+  EXPECT_EQ("Plain", error_message(plain));
+}
+
+// ----------------------------------------------------------------------------
+// Shared Frames
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that copies of an error share their frames, extend them
+//              independently, and can be released on another thread.
+//
+// ----------------------------------------------------------------------------
+TEST(ErrorContextTest, SharedFrames) {
+  auto base = Either<int>{1} | halveE | context("base");
+  auto copy = base;
+  auto left = std::move(base) | context("left");
+  auto right = std::move(copy) | context("right");
+
+  EXPECT_EQ("left: base: Odd number", error_message(std::get<Err>(left)));
+  EXPECT_EQ("right: base: Odd number", error_message(std::get<Err>(right)));
+  EXPECT_EQ(
+    std::get<Err>(left).context().head()->parent(),
+    std::get<Err>(right).context().head()->parent()
+  );
+
+  std::thread other{[moved = std::move(left)] {
+    EXPECT_EQ("left: base: Odd number", error_message(std::get<Err>(moved)));
+  }};
+  other.join();
+  EXPECT_EQ("right: base: Odd number", error_message(std::get<Err>(right)));
+}
+
+// ----------------------------------------------------------------------------
+// Thread Exit
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that an error holding pooled frames can be destroyed
+//              during thread exit, after the thread's frame pool is gone.
+//
+// ----------------------------------------------------------------------------
+TEST(ErrorContextTest, ThreadExit) {
+  std::thread other{[] {
+    // Constructed before the frame pool, so destroyed after it.
+    thread_local Either<int> late{0};
+    late = Either<int>{1} | halveE | context("in record ", 1234);
+    EXPECT_EQ(
+      "in record 1234: Odd number",
+      error_message(std::get<Err>(late))
+    );
+  }};
+  other.join();
+
+  void* block = FramePool::allocate(100);
+  FramePool::deallocate(block, 100);
+  EXPECT_LE(1u, FramePool::cached(100));
+}
+
+// End of 'TestErrorContext.cpp'
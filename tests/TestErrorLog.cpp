@@ -0,0 +1,264 @@
+// ============================================================================
+// Unit tests for the asynchronous error event log using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestErrorLog.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "ErrorLog.h" // Include the error log header
+
+// Standard library headers
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+class OddNumberErr : public Err {
+public:
+  explicit OddNumberErr() : Err{"Odd number"} {};
+};
+
+Either<int> halveE(int a) {
+  if (0 != a % 2) {
+    return LOG_ERROR(OddNumberErr{});
+  }
+
+  return a / 2;
+}
+
+Either<int> rejectE(int) {
+  return Err{"Rejected"};
+}
+
+// Reads the lines of the file at 'path'.
+std::vector<std::string> read_lines(std::string const& path) {
+  std::ifstream in{path};
+  std::vector<std::string> lines{};
+  for (std::string line; std::getline(in, line);) {
+    lines.push_back(line);
+  }
+
+  return lines;
+}
+
+std::size_t count_containing(
+  std::vector<std::string> const& lines,
+  std::string const& what
+) {
+  std::size_t count = 0;
+  for (auto const& line : lines) {
+    if (std::string::npos != line.find(what)) {
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Error Codes
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that equal messages get equal codes and different
+//              messages different ones.
+//
+// ----------------------------------------------------------------------------
+TEST(ErrorLogTest, ErrorCodes) {
+  std::string copy{"Odd number"};
+  EXPECT_EQ(error_code("Odd number"), error_code(copy.c_str()));
+  EXPECT_NE(error_code("Odd number"), error_code("Odd numbers"));
+  EXPECT_NE(error_code("Failed to create 'ExpensiveToCopy'"),
+            error_code("Failed to create 'ExpensiveToMove'"));
+}
+
+// ----------------------------------------------------------------------------
+// Drained Events
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that errors logged by several threads end up in the log
+//              file with their call sites, and that only sampled events carry
+//              the message.
+//
+// ----------------------------------------------------------------------------
+TEST(ErrorLogTest, DrainedEvents) {
+  std::string path = testing::TempDir() + "error_log_test.log";
+  auto& log = ErrorLog::instance();
+
+  // Nothing is logged before the log is started.
+  (void)(Either<int>{1} | halveE);
+
+  ASSERT_TRUE(log.start(path, 10, std::chrono::milliseconds{1}));
+  EXPECT_FALSE(log.start(path));
+
+  std::vector<std::thread> threads{};
+  for (int t = 0; t < 3; ++t) {
+    threads.emplace_back([] {
+      for (int i = 0; i < 100; ++i) {
+        (void)(Either<int>{2 * i + 1} | halveE);
+        (void)(Either<int>{i} | LOGGED(rejectE));
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  log.stop();
+
+  auto lines = read_lines(path);
+  std::remove(path.c_str());
+
+  EXPECT_EQ(600u, lines.size());
+  EXPECT_EQ(600u, count_containing(lines, "TestErrorLog.cpp:"));
+  EXPECT_EQ(60u, count_containing(lines, " message="));
+  EXPECT_EQ(0u, count_containing(lines, "dropped="));
+
+  for (char const* message : {"Odd number", "Rejected"}) {
+    char code[16];
+    std::snprintf(code, sizeof(code), "code=%08x", error_code(message));
+    EXPECT_EQ(300u, count_containing(lines, code));
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Reused Rings
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that threads logging one after another reuse the rings
+//              of exited threads once they are drained, without losing any
+//              of their events, and that logging a temporary returns a copy
+//              of it.
+//
+// ----------------------------------------------------------------------------
+TEST(ErrorLogTest, ReusedRings) {
+  std::string path = testing::TempDir() + "error_log_rings_test.log";
+  auto& log = ErrorLog::instance();
+
+  ASSERT_TRUE(log.start(path, 1, std::chrono::milliseconds{1}));
+  for (int t = 0; t < 50; ++t) {
+    std::thread{[] { (void)(Either<int>{1} | halveE); }}.join();
+    std::this_thread::sleep_for(std::chrono::milliseconds{2});
+  }
+  auto rings = log.ring_count();
+  log.stop();
+
+  auto lines = read_lines(path);
+  std::remove(path.c_str());
+
+  EXPECT_EQ(50u, count_containing(lines, "message=\"Odd number\""));
+  EXPECT_LT(rings, 25u);
+
+  static constexpr ErrorSite site{__FILE__, __LINE__, __func__};
+  OddNumberErr error{};
+  static_assert(std::is_same_v<
+    OddNumberErr,
+    decltype(log_error(site, OddNumberErr{}))
+  >);
+  static_assert(std::is_same_v<
+    OddNumberErr&,
+    decltype(log_error(site, error))
+  >);
+}
+
+// ----------------------------------------------------------------------------
+// Stopped Exit
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that threads exiting after the log stopped hand their
+//              rings on at once, and that long messages are truncated
+//              rather than allocated.
+//
+// ----------------------------------------------------------------------------
+TEST(ErrorLogTest, StoppedExit) {
+  std::string path = testing::TempDir() + "error_log_stopped_test.log";
+  auto& log = ErrorLog::instance();
+  std::string long_message(2 * ErrorRing::kMessageSize, 'x');
+
+  ASSERT_TRUE(log.start(path, 1, std::chrono::milliseconds{1}));
+  std::atomic<int> logged{0};
+  std::promise<void> stopped{};
+  auto exit = stopped.get_future().share();
+  std::vector<std::thread> threads{};
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&logged, exit, &long_message] {
+      (void)(Either<int>{1} | halveE);
+      (void)LOG_ERROR(Err{long_message});
+      ++logged;
+      exit.wait();
+    });
+  }
+  while (8 > logged) {
+    std::this_thread::yield();
+  }
+  log.stop();
+  stopped.set_value();
+  for (auto& t : threads) {
+    t.join();
+  }
+  auto rings = log.ring_count();
+
+  auto lines = read_lines(path);
+  EXPECT_EQ(8u, count_containing(lines, "message=\"Odd number\""));
+  EXPECT_EQ(8u, count_containing(lines,
+    "message=\"" + long_message.substr(0, ErrorRing::kMessageSize) + "...\""));
+
+  // The second round reuses the handed on rings instead of adding more.
+  ASSERT_TRUE(log.start(path, 1, std::chrono::milliseconds{1}));
+  threads.clear();
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([] { (void)(Either<int>{1} | halveE); });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  log.stop();
+  std::remove(path.c_str());
+
+  EXPECT_EQ(rings, log.ring_count());
+}
+
+// End of 'TestErrorLog.cpp'
@@ -0,0 +1,171 @@
+// ============================================================================
+// Unit tests for the stage latency histograms using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestLatencyHistogram.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "LatencyHistogram.h" // Include the latency histograms header
+
+// Standard library headers
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+using namespace std::chrono_literals;
+
+Either<int> fastE(int a) {
+  return a + 1;
+}
+
+Either<int> slowE(int a) {
+  std::this_thread::sleep_for(2ms);
+  return a + 1;
+}
+
+Either<int> failE(int) {
+  return Err{"Failed"};
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Buckets
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that every value falls into a bucket whose range holds
+//              it and whose width is at most 12.5% of its lower bound.
+//
+// ----------------------------------------------------------------------------
+TEST(LatencyHistogramTest, Buckets) {
+  for (std::uint64_t v : {0ull, 1ull, 7ull, 8ull, 15ull, 16ull, 17ull, 1000ull,
+                          123456789ull, ~0ull}) {
+    auto b = LogHistogram::bucket_of(v);
+    ASSERT_LT(b, LogHistogram::kBuckets);
+    EXPECT_LE(LogHistogram::lower_bound(b), v);
+    if (b + 1 < LogHistogram::kBuckets) {
+      EXPECT_GT(LogHistogram::lower_bound(b + 1), v);
+    }
+    if (8 <= v) {
+      EXPECT_LE(
+        LogHistogram::lower_bound(b + 1) - LogHistogram::lower_bound(b),
+        LogHistogram::lower_bound(b) / 8
+      );
+    }
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Pipeline
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that each stage is timed into its own histogram, merged
+//              across threads, and that short-circuited stages are skipped.
+//
+// ----------------------------------------------------------------------------
+TEST(LatencyHistogramTest, Pipeline) {
+  LatencyHistograms latency{{"fast", "slow"}};
+
+  auto work = [&latency](int n) {
+    for (int i = 0; i < n; ++i) {
+      auto r = (with_latency(Either<int>{i}, latency)
+        | fastE
+        | slowE
+        | failE
+        | fastE).result();
+      EXPECT_STREQ("Failed", std::get<Err>(r).what());
+    }
+  };
+
+  std::vector<std::thread> threads{};
+  for (int t = 0; t < 3; ++t) {
+    threads.emplace_back(work, 10);
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  auto stages = latency.snapshot();
+  ASSERT_EQ(3u, stages.size());
+
+  EXPECT_EQ("fast", stages[0].name);
+  EXPECT_EQ(30u, stages[0].count);
+  EXPECT_LT(stages[0].p50, 1e6);
+
+  EXPECT_EQ("slow", stages[1].name);
+  EXPECT_EQ(30u, stages[1].count);
+  EXPECT_GE(stages[1].p50, 1.5e6);
+  EXPECT_LE(stages[1].p50, stages[1].p99);
+  EXPECT_LE(stages[1].p99, stages[1].p999);
+  EXPECT_LE(stages[1].p999, stages[1].max);
+
+  EXPECT_EQ("stage 2", stages[2].name);
+  EXPECT_EQ(30u, stages[2].count);
+}
+
+// ----------------------------------------------------------------------------
+// Thread Slots
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that threads coming one after another reuse the sets of
+//              histograms of the threads that exited, instead of ending up
+//              in the shared set.
+//
+// ----------------------------------------------------------------------------
+TEST(LatencyHistogramTest, ThreadSlots) {
+  LatencyHistograms latency{};
+
+  for (std::size_t t = 0; t < 2 * LatencyHistograms::kMaxThreads; ++t) {
+    std::size_t index = 0;
+    std::thread{[&] {
+      index = LatencyHistograms::thread_index();
+      latency.record(0, 100);
+    }}.join();
+    ASSERT_GT(LatencyHistograms::kMaxThreads - 1, index);
+  }
+
+  auto stages = latency.snapshot();
+  ASSERT_EQ(1u, stages.size());
+  EXPECT_EQ(2 * LatencyHistograms::kMaxThreads, stages[0].count);
+}
+
+// End of 'TestLatencyHistogram.cpp'
@@ -36,7 +36,9 @@
 #include "Maybe.h" // Include the header file for the Maybe monad
 
 // Standard library headers
+#include <array>
 #include <cmath> // Include for mathematical functions like std::sqrt
+#include <utility>
 
 // External libraries headers
 #include <gtest/gtest.h>  // GoogleTest framework for unit testing
@@ -80,6 +82,31 @@ auto squareRoot(int a) -> Maybe<float> {
   return std::sqrt(static_cast<float>(a));
 }
 
+// A constexpr function that halves an even integer and returns it wrapped in
+// a Maybe. Returns the std::nullopt if the input is odd.
+constexpr auto halveEven(int a) -> Maybe<int> {
+  if (0 != a % 2) {
+    return {};
+  }
+
+  return a / 2;
+}
+
+// A stage that can't throw, next to multiplyOne which may.
+auto incrementNothrow(int a) noexcept -> Maybe<int> {
+  return a + 1;
+}
+
+// Table of the inputs divisible by four, quartered, computed at compile time.
+constexpr std::array<int, 16> kQuarters = [] {
+  std::array<int, 16> table{};
+  for (int i = 0; i < 16; ++i) {
+    table[i] = (Maybe<int>{i} | halveEven | halveEven).value_or(-1);
+  }
+
+  return table;
+}();
+
 
 // Test fixture class 'MaybeTest' that inherits from testing::Test.
 // This allows setting up common objects and state for multiple test cases.
@@ -276,4 +303,54 @@ TEST_F(MaybeTest, PipeOperator) {
   EXPECT_THROW(r5.value(), std::bad_optional_access);
 }
 
+// ----------------------------------------------------------------------------
+// Constant Evaluation
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that chains of constexpr functions on literal payloads
+//              are evaluated at compile time, and give the same results at
+//              run time.
+//
+// ----------------------------------------------------------------------------
+TEST_F(MaybeTest, ConstantEvaluation) {
+  static_assert(2 == (Maybe<int>{8} | halveEven | halveEven).value());
+  static_assert(!(Maybe<int>{6} | halveEven | halveEven).has_value());
+  static_assert(!(Maybe<int>{} | halveEven).has_value());
+  static_assert(3 == mbind(Maybe<int>{12}, halveEven).value_or(0) / 2);
+  static_assert(
+    2.5 == (Maybe<int>{10}
+      | halveEven
+      | [](int a) -> Maybe<double> { return a / 2.0; }).value()
+  );
+
+  static_assert(-1 == kQuarters[6]);
+  static_assert(3 == kQuarters[12]);
+
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_EQ(
+      (Maybe<int>{i} | halveEven | halveEven).value_or(-1),
+      kQuarters[i]
+    );
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Noexcept
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that binds and pipes are noexcept exactly when every
+//              stage they invoke is.
+//
+// ----------------------------------------------------------------------------
+TEST_F(MaybeTest, Noexcept) {
+  static_assert(noexcept(mbind(valid, incrementNothrow)));
+  static_assert(noexcept(Maybe<int>{1} | incrementNothrow | incrementNothrow));
+  auto identity = [](int a) noexcept -> Maybe<int> { return a; };
+  static_assert(noexcept(Maybe<int>{1} | identity | std::move(identity)));
+  static_assert(!noexcept(mbind(valid, multiplyOne)));
+  static_assert(!noexcept(Maybe<int>{1} | incrementNothrow | multiplyOne));
+
+  EXPECT_EQ(44, (Maybe<int>{42} | incrementNothrow | incrementNothrow).value());
+}
+
 // End of 'TestMaybe.cpp'
\ No newline at end of file
@@ -0,0 +1,210 @@
+// ============================================================================
+// Unit tests for the Prometheus metrics registry using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestMetricsRegistry.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "MetricsRegistry.h" // Include the metrics registry header
+
+// Standard library headers
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+class OddNumberErr : public Err {
+public:
+  explicit OddNumberErr() : Err{"Odd \"number\""} {};
+};
+
+Either<int> halveE(int a) {
+  if (0 != a % 2) {
+    return OddNumberErr{};
+  }
+
+  return a / 2;
+}
+
+Maybe<int> halveM(int a) {
+  if (0 != a % 2) {
+    return std::nullopt;
+  }
+
+  return a / 2;
+}
+
+// Tells whether 'text' contains the line 'line'.
+bool has_line(std::string const& text, std::string const& line) {
+  return std::string::npos != ("\n" + text).find("\n" + line + "\n");
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Outcomes
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that stage and pipeline outcomes, error kinds and
+//              latencies recorded by several threads are all exported.
+//
+// ----------------------------------------------------------------------------
+TEST(MetricsRegistryTest, Outcomes) {
+  auto& registry = MetricsRegistry::instance();
+  auto& either = registry.pipeline("either", {"first", "second"});
+  auto& maybe = registry.pipeline("maybe");
+  EXPECT_EQ(&either, &registry.pipeline("either"));
+
+  // Inputs 0..3: both stages succeed for 0, the second fails for 2 and the
+  // first fails for 1 and 3, skipping the second.
+  std::vector<std::thread> threads{};
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < 100; ++i) {
+        (void)(with_metrics(Either<int>{t}, either)
+          | halveE
+          | halveE).result();
+      }
+      (void)(with_metrics(Maybe<int>{t}, maybe) | halveM).result();
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(100u, either.pipeline_count(kMetricSucceeded));
+  EXPECT_EQ(300u, either.pipeline_count(kMetricFailed));
+
+  std::ostringstream out{};
+  registry.write(out);
+  auto text = out.str();
+
+  EXPECT_TRUE(has_line(text,
+    "# TYPE monadic_stage_outcomes_total counter"));
+  EXPECT_TRUE(has_line(text, "monadic_pipeline_outcomes_total"
+    "{pipeline=\"either\",outcome=\"failed\"} 300"));
+  EXPECT_TRUE(has_line(text, "monadic_stage_outcomes_total"
+    "{pipeline=\"either\",stage=\"first\",outcome=\"succeeded\"} 200"));
+  EXPECT_TRUE(has_line(text, "monadic_stage_outcomes_total"
+    "{pipeline=\"either\",stage=\"second\",outcome=\"failed\"} 100"));
+  EXPECT_TRUE(has_line(text, "monadic_stage_outcomes_total"
+    "{pipeline=\"either\",stage=\"second\",outcome=\"skipped\"} 200"));
+  EXPECT_TRUE(has_line(text, "monadic_stage_outcomes_total"
+    "{pipeline=\"maybe\",stage=\"stage 0\",outcome=\"failed\"} 2"));
+  EXPECT_TRUE(has_line(text, "monadic_stage_errors_total"
+    "{pipeline=\"either\",stage=\"first\",kind=\"Odd \\\"number\\\"\"} 200"));
+  EXPECT_TRUE(has_line(text, "monadic_stage_errors_total"
+    "{pipeline=\"either\",stage=\"second\",kind=\"Odd \\\"number\\\"\"} 100"));
+  EXPECT_TRUE(has_line(text, "monadic_stage_latency_seconds_count"
+    "{pipeline=\"either\",stage=\"second\"} 200"));
+  EXPECT_NE(std::string::npos, text.find("monadic_stage_latency_seconds"
+    "{pipeline=\"either\",stage=\"first\",quantile=\"0.99\"} "));
+}
+
+// ----------------------------------------------------------------------------
+// Valueless
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that a stage returning an Either left valueless by an
+//              exception is counted as failed under the "valueless" kind.
+//
+// ----------------------------------------------------------------------------
+TEST(MetricsRegistryTest, Valueless) {
+  struct Throwing {
+    std::string text{};
+
+    Throwing() = default;
+    explicit Throwing(int) { throw std::runtime_error{"Failed"}; }
+  };
+
+  auto valuelessE = [](int) {
+    Either<Throwing> e{};
+    try {
+      e.emplace<0>(1);
+    } catch (std::runtime_error const&) { }
+
+    return e;
+  };
+
+  auto& metrics = MetricsRegistry::instance().pipeline("valueless");
+  auto r = (with_metrics(Either<int>{1}, metrics) | valuelessE).result();
+  ASSERT_TRUE(r.valueless_by_exception());
+
+  EXPECT_EQ(1u, metrics.stage_count(0, kMetricFailed));
+  EXPECT_EQ(1u, metrics.pipeline_count(kMetricFailed));
+  auto errors = metrics.errors();
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ("valueless", errors[0].kind);
+  EXPECT_EQ(1u, errors[0].count);
+}
+
+// ----------------------------------------------------------------------------
+// Periodic Dump
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the metrics are dumped into a file on a timer and
+//              once more when dumping stops.
+//
+// ----------------------------------------------------------------------------
+TEST(MetricsRegistryTest, PeriodicDump) {
+  std::string path = testing::TempDir() + "metrics_registry_test.prom";
+  auto& registry = MetricsRegistry::instance();
+  auto& dumped = registry.pipeline("dumped");
+
+  ASSERT_TRUE(registry.start_dumping(path, std::chrono::milliseconds{1}));
+  EXPECT_FALSE(registry.start_dumping(path));
+  (void)(with_metrics(Either<int>{4}, dumped) | halveE).result();
+  registry.stop_dumping();
+
+  std::ifstream in{path};
+  std::stringstream text{};
+  text << in.rdbuf();
+  std::remove(path.c_str());
+
+  EXPECT_TRUE(has_line(text.str(), "monadic_pipeline_outcomes_total"
+    "{pipeline=\"dumped\",outcome=\"succeeded\"} 1"));
+}
+
+// End of 'TestMetricsRegistry.cpp'
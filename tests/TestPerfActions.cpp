@@ -0,0 +1,134 @@
+// ============================================================================
+// Unit tests for the benchmark and profile program actions using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestPerfActions.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include <ProgramActions/BenchmarkStrategy.h>
+#include <ProgramActions/ProfileStrategy.h>
+
+// Standard library headers
+#include <cstdint>
+#include <string>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Workloads counting their calls, one of them also counting "copies".
+PerfWorkloads counting_workloads(std::uint64_t& calls, std::uint64_t& copies) {
+  PerfWorkloads workloads{};
+  workloads
+    .add_workload("plain", [&calls] { ++calls; })
+    .add_workload("copying", [&calls, &copies] { ++calls; copies += 2; })
+    .add_counter("copies", [&copies] { return copies; });
+
+  return workloads;
+}
+
+// Finds the line of the report that starts with 'name'.
+std::string report_line(std::string const& report, std::string const& name) {
+  auto begin = report.find("\n" + name + " ");
+  if (std::string::npos == begin) {
+    return {};
+  }
+
+  return report.substr(begin + 1, report.find('\n', begin + 1) - begin - 1);
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Benchmark
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that every workload is warmed up and run the requested
+//              number of times and that counters are reported per call.
+//
+// ----------------------------------------------------------------------------
+TEST(PerfActionsTest, Benchmark) {
+  std::uint64_t calls = 0;
+  std::uint64_t copies = 0;
+  BenchmarkAction action{
+    BenchmarkStrategy{counting_workloads(calls, copies), 100, 3}
+  };
+
+  testing::internal::CaptureStdout();
+  EXPECT_EQ(EXIT_SUCCESS, action.execute("bench"));
+  auto report = testing::internal::GetCapturedStdout();
+
+  EXPECT_EQ(2u * (10 + 3 * 100), calls);
+  EXPECT_EQ(0u, report.find("bench: benchmark, 3 x 100 calls"));
+  EXPECT_NE(std::string::npos, report.find("copies/call"));
+  EXPECT_NE(std::string::npos, report_line(report, "plain").find(" 0.000"));
+  EXPECT_NE(std::string::npos, report_line(report, "copying").find(" 2.000"));
+}
+
+// ----------------------------------------------------------------------------
+// Profile
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that every call is profiled between the start and stop
+//              hooks and that counters are reported per call.
+//
+// ----------------------------------------------------------------------------
+TEST(PerfActionsTest, Profile) {
+  std::uint64_t calls = 0;
+  std::uint64_t copies = 0;
+  std::uint64_t calls_at_start = 1;
+  std::uint64_t calls_at_stop = 0;
+  ProfileAction action{ProfileStrategy{
+    counting_workloads(calls, copies),
+    50,
+    [&] { calls_at_start = calls; },
+    [&] { calls_at_stop = calls; }
+  }};
+
+  testing::internal::CaptureStdout();
+  EXPECT_EQ(EXIT_SUCCESS, action.execute("profile"));
+  auto report = testing::internal::GetCapturedStdout();
+
+  EXPECT_EQ(0u, calls_at_start);
+  EXPECT_EQ(100u, calls_at_stop);
+  EXPECT_EQ(0u, report.find("profile: profile, 50 calls per workload"));
+  EXPECT_NE(std::string::npos, report.find("p99 ns"));
+  EXPECT_NE(std::string::npos, report_line(report, "copying").find(" 2.000"));
+}
+
+// End of 'TestPerfActions.cpp'
@@ -0,0 +1,196 @@
+// ============================================================================
+// Unit tests for the pipeline trace-event recording using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestPipelineTrace.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "PipelineTrace.h" // Include the pipeline trace header
+
+// Standard library headers
+#include <iterator>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+Either<int> tracedDoubleE(int a) {
+  return 2 * a;
+}
+
+Maybe<int> tracedDoubleM(int a) {
+  return 2 * a;
+}
+
+// Counts the occurrences of 'what' in 's'.
+std::size_t occurrences(std::string const& s, std::string const& what) {
+  std::size_t count = 0;
+  for (auto pos = s.find(what); std::string::npos != pos;
+       pos = s.find(what, pos + what.size())) {
+    ++count;
+  }
+
+  return count;
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Trace Events
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the stages which ran while tracing was enabled are
+//              written as complete events named after their symbol, label or
+//              type, one thread id per recording thread.
+//
+// ----------------------------------------------------------------------------
+TEST(PipelineTraceTest, TraceEvents) {
+  auto& tracer = Tracer::instance();
+
+  // Nothing is recorded before tracing is enabled.
+  auto r0 = (with_tracing(Either<int>{1}, "untraced") | tracedDoubleE).result();
+  EXPECT_EQ(2, std::get<int>(r0));
+
+  tracer.enable();
+  auto r1 = (with_tracing(Either<int>{1}, "either pipeline")
+    | tracedDoubleE
+    | labeled("quadruple", [](int a) -> Either<int> { return 4 * a; })
+    | [](int) -> Either<int> { return Err{"Failed"}; }
+    | tracedDoubleE).result();
+  EXPECT_STREQ("Failed", std::get<Err>(r1).what());
+
+  std::thread worker{[] {
+    auto r = (with_tracing(Maybe<int>{1}) | tracedDoubleM).result();
+    EXPECT_EQ(2, r.value());
+  }};
+  worker.join();
+  tracer.enable(false);
+
+  std::ostringstream out{};
+  tracer.write_json(out);
+  auto json = out.str();
+
+  EXPECT_EQ(0u, json.rfind("{\"traceEvents\":[", 0));
+  EXPECT_EQ(0u, occurrences(json, "untraced"));
+  EXPECT_EQ(1u, occurrences(json, "\"either pipeline\""));
+  EXPECT_EQ(1u, occurrences(json, "\"tracedDoubleE(int)\""));
+  EXPECT_EQ(1u, occurrences(json, "\"quadruple\""));
+  EXPECT_EQ(1u, occurrences(json, "\"tracedDoubleM(int)\""));
+  EXPECT_EQ(1u, occurrences(json, "lambda"));
+  EXPECT_EQ(5u, occurrences(json, "\"ph\":\"X\""));
+  EXPECT_EQ(4u, occurrences(json, "\"tid\":1,"));
+  EXPECT_EQ(1u, occurrences(json, "\"tid\":2,"));
+}
+
+// ----------------------------------------------------------------------------
+// Thread Buffers
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that threads which exited hand their buffers over to
+//              the next ones while their events stay in the trace, and that
+//              timestamps are written to the nanosecond.
+//
+// ----------------------------------------------------------------------------
+TEST(PipelineTraceTest, ThreadBuffers) {
+  auto& tracer = Tracer::instance();
+  auto run = [] {
+    auto r = (with_tracing(Maybe<int>{1})
+      | labeled("short-lived", tracedDoubleM)).result();
+    EXPECT_EQ(2, r.value());
+  };
+
+  tracer.enable();
+  std::thread{run}.join();
+  auto buffers = tracer.buffer_count();
+  for (int i = 0; i < 8; ++i) {
+    std::thread{run}.join();
+  }
+  tracer.enable(false);
+  EXPECT_EQ(buffers, tracer.buffer_count());
+
+  std::ostringstream out{};
+  tracer.write_json(out);
+  auto json = out.str();
+
+  EXPECT_EQ(9u, occurrences(json, "\"short-lived\""));
+  std::regex timed{"\"ts\":[0-9]+\\.[0-9]{3},\"dur\":[0-9]+\\.[0-9]{3}\\}"};
+  EXPECT_EQ(
+    occurrences(json, "\"ph\":\"X\""),
+    static_cast<std::size_t>(std::distance(
+      std::sregex_iterator{json.begin(), json.end(), timed},
+      std::sregex_iterator{}
+    ))
+  );
+}
+
+// ----------------------------------------------------------------------------
+// Retired Events
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that only the newest events of exited threads are kept
+//              and that the others are counted as dropped.
+//
+// ----------------------------------------------------------------------------
+TEST(PipelineTraceTest, RetiredEvents) {
+  auto& tracer = Tracer::instance();
+  auto dropped = tracer.dropped_events();
+  auto fill = [&tracer] {
+    for (std::size_t i = 0; i < TraceBuffer::kCapacity; ++i) {
+      tracer.record(i, i + 1, TraceName{"filler", nullptr, nullptr});
+    }
+  };
+
+  std::size_t threads = Tracer::kMaxRetiredEvents / TraceBuffer::kCapacity;
+  for (std::size_t t = 0; t < threads + 2; ++t) {
+    std::thread{fill}.join();
+  }
+
+  std::ostringstream out{};
+  tracer.write_json(out);
+  EXPECT_GE(
+    Tracer::kMaxRetiredEvents,
+    occurrences(out.str(), "\"ph\":\"X\"")
+  );
+  EXPECT_LE(2 * TraceBuffer::kCapacity, tracer.dropped_events() - dropped);
+}
+
+// End of 'TestPipelineTrace.cpp'
@@ -0,0 +1,158 @@
+// ============================================================================
+// Unit tests for the optional Either error stack traces using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestStackTrace.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "Either.h" // Include the Either header, built with stack traces
+
+// Standard library headers
+#include <cstdint>
+#include <string>
+#include <thread>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+class OddNumberErr : public Err {
+public:
+  explicit OddNumberErr() : Err{"Odd number"} {};
+};
+
+__attribute__((noinline)) Either<int> tracedHalveE(int a) {
+  if (0 != a % 2) {
+    return OddNumberErr{};
+  }
+
+  return a / 2;
+}
+
+__attribute__((noinline)) Either<int> tracedCallerE(int a) {
+  auto r = Either<int>{a} | tracedHalveE;
+  asm volatile("" ::: "memory");  // Keep the call out of tail position
+
+  return r;
+}
+
+__attribute__((noinline)) std::string walkedCaller() {
+  void* frames[4];
+  std::size_t depth = walk_frame_pointers(frames, 4);
+
+  return 0 < depth
+    ? symbol_name(static_cast<char const*>(frames[0]) - 1)
+    : std::string{};
+}
+
+__attribute__((noinline)) std::string unwoundCaller() {
+  void* frames[4];
+  std::size_t depth = unwind_frames(frames, 4);
+
+  return 1 < depth
+    ? symbol_name(static_cast<char const*>(frames[0]) - 1)
+    : std::string{};
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Capture
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that both capture methods start at their caller.
+//
+// ----------------------------------------------------------------------------
+TEST(StackTraceTest, Capture) {
+  EXPECT_EQ(0u, walkedCaller().find("walkedCaller"));
+  EXPECT_EQ(0u, unwoundCaller().find("unwoundCaller"));
+}
+
+// ----------------------------------------------------------------------------
+// Stack Bounds
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that the frame walk is bounded by a stack range holding
+//              the calling thread's locals, on the main and other threads.
+//
+// ----------------------------------------------------------------------------
+TEST(StackTraceTest, StackBounds) {
+  auto check = [] {
+    int local = 0;
+    auto address = reinterpret_cast<std::uintptr_t>(&local);
+    StackBounds const& stack = thread_stack_bounds();
+    EXPECT_LE(stack.low, address);
+    EXPECT_GT(stack.high, address);
+    EXPECT_EQ(0u, walkedCaller().find("walkedCaller"));
+  };
+
+  check();
+  std::thread other{check};
+  other.join();
+}
+
+// ----------------------------------------------------------------------------
+// Error Trace
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that an error carries the stack it was created on,
+//              shared by its copies and symbolized when formatted.
+//
+// ----------------------------------------------------------------------------
+TEST(StackTraceTest, ErrorTrace) {
+  auto r = tracedCallerE(3);
+  ASSERT_EQ(1u, r.index());
+
+  ASSERT_NE(nullptr, stack_trace_hooks.load());
+  StackTrace const* trace = std::get<Err>(r).stack_trace();
+  ASSERT_NE(nullptr, trace);
+  EXPECT_LE(3u, trace->depth());
+
+  auto copy = r;
+  EXPECT_EQ(trace, std::get<Err>(copy).stack_trace());
+
+  auto text = trace->format();
+  auto halve = text.find("tracedHalveE(int)");
+  auto caller = text.find("tracedCallerE(int)");
+  ASSERT_NE(std::string::npos, halve);
+  ASSERT_NE(std::string::npos, caller);
+  EXPECT_LT(halve, caller);
+  EXPECT_EQ(0u, text.find("#0 0x"));
+}
+
+// End of 'TestStackTrace.cpp'
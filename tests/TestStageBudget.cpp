@@ -0,0 +1,147 @@
+// ============================================================================
+// Unit tests for the budgeted stage scheduler using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestStageBudget.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "StageBudget.h" // Include the budgeted stage scheduler header
+
+// Standard library headers
+#include <chrono>
+#include <string>
+#include <thread>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+using namespace std::chrono_literals;
+
+// A stage parsing its input, taking about 5 ms.
+Maybe<int> parseM(std::string s) {
+  std::this_thread::sleep_for(5ms);
+  return std::stoi(s);
+}
+
+// An enrichment stage, cheap in practice but declared as expensive.
+Maybe<int> enrichM(int a) {
+  return a * 10;
+}
+
+Either<int> parseE(std::string s) {
+  std::this_thread::sleep_for(5ms);
+  return std::stoi(s);
+}
+
+Either<int> enrichE(int a) {
+  return a * 10;
+}
+
+Either<int> rejectE(int) {
+  return Err{"Rejected"};
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Maybe Pipeline
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that optional stages run while the budget allows and
+//              turn into Nothing once the remaining budget is too small.
+//
+// ----------------------------------------------------------------------------
+TEST(StageBudgetTest, MaybePipeline) {
+  TimeBudget generous{1s};
+  auto r1 = (with_budget(Maybe<std::string>{"4"}, generous)
+    | stage("parse", 5ms, parseM)
+    | optional_stage("enrich", 100ms, enrichM)).result();
+  EXPECT_EQ(40, r1.value());
+
+  TimeBudget tight{50ms};
+  auto r2 = (with_budget(Maybe<std::string>{"4"}, tight)
+    | stage("parse", 5ms, parseM)
+    | optional_stage("enrich", 100ms, enrichM)).result();
+  EXPECT_FALSE(r2);
+
+  auto const& records = tight.records();
+  ASSERT_EQ(2u, records.size());
+  EXPECT_STREQ("parse", records[0].name);
+  EXPECT_EQ(StageOutcome::kRan, records[0].outcome);
+  EXPECT_GE(records[0].consumed, 5ms);
+  EXPECT_STREQ("enrich", records[1].name);
+  EXPECT_EQ(StageOutcome::kSkipped, records[1].outcome);
+  EXPECT_EQ(100ms, records[1].expected);
+  EXPECT_LT(records[1].remaining, 50ms);
+}
+
+// ----------------------------------------------------------------------------
+// Either Pipeline
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that skipped optional Either stages pass their input
+//              through, that plain callables run as required stages and that
+//              stages after a failure are recorded as short-circuited.
+//
+// ----------------------------------------------------------------------------
+TEST(StageBudgetTest, EitherPipeline) {
+  TimeBudget tight{50ms};
+  auto r1 = (with_budget(Either<std::string>{"4"}, tight)
+    | parseE
+    | optional_stage("enrich", 100ms, enrichE)
+    | stage("enrich again", 100ms, enrichE)).result();
+  EXPECT_EQ(40, std::get<int>(r1));
+
+  auto const& records = tight.records();
+  ASSERT_EQ(3u, records.size());
+  EXPECT_EQ(nullptr, records[0].name);
+  EXPECT_EQ(StageOutcome::kRan, records[0].outcome);
+  EXPECT_EQ(StageOutcome::kSkipped, records[1].outcome);
+  EXPECT_EQ(StageOutcome::kRan, records[2].outcome);
+
+  TimeBudget generous{1s};
+  auto r2 = (with_budget(Either<int>{4}, generous)
+    | stage("reject", 1ms, rejectE)
+    | stage("enrich", 1ms, enrichE)).result();
+  EXPECT_STREQ("Rejected", std::get<Err>(r2).what());
+  ASSERT_EQ(2u, generous.records().size());
+  EXPECT_EQ(StageOutcome::kShortCircuit, generous.records()[1].outcome);
+}
+
+// End of 'TestStageBudget.cpp'
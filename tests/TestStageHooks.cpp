@@ -0,0 +1,226 @@
+// ============================================================================
+// Unit tests for the pipeline stage hooks using GoogleTest.
+//  Copyright (C) 2025 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// This file is part of Cpp-Monadic-Types.
+//
+// Cpp-Monadic-Types is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software  Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// Cpp-Monadic-Types is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Cpp-Monadic-Types. If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-18 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TestStageHooks.cpp: created.
+//
+// ============================================================================
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Test source
+#include "StageHooks.h"  // Include the stage hooks header
+
+// Project headers
+#include "Cancellation.h"
+#include "LatencyHistogram.h"
+#include "MetricsRegistry.h"
+#include "PipelineTrace.h"
+#include "StageBudget.h"
+
+// Standard library headers
+#include <chrono>
+#include <sstream>
+#include <string>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework for unit testing
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+using namespace std::chrono_literals;
+
+Either<int> incrementE(int a) {
+  return a + 1;
+}
+
+Either<int> rejectE(int) {
+  return Err{"Rejected"};
+}
+
+Maybe<int> incrementM(int a) {
+  return a + 1;
+}
+
+// Hook counting what it is shown of a pipeline.
+struct CountingHook : StageHook {
+  int* ran;
+  int* skipped_count;
+  int* finished;
+
+  template <typename Out, typename S, typename M, typename Next>
+  Out around(std::size_t, S const&, M&, Next&& next) {
+    ++*ran;
+    return std::forward<Next>(next)();
+  }
+
+  template <typename S>
+  void skipped(std::size_t, S const&) {
+    ++*skipped_count;
+  }
+
+  template <typename M>
+  void finish(M const&) {
+    ++*finished;
+  }
+};
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Nested Hooks
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that hooks attached by different with_*() functions
+//              all see the stages of one pipeline, that short-circuited
+//              stages are only reported as skipped and that result()
+//              finishes every hook.
+//
+// ----------------------------------------------------------------------------
+TEST(StageHooksTest, NestedHooks) {
+  int ran = 0;
+  int skipped = 0;
+  int finished = 0;
+  auto& metrics = MetricsRegistry::instance().pipeline("nested hooks");
+  LatencyHistograms latency{};
+  TimeBudget budget{1s};
+
+  auto r = (with_budget(
+      attach_hook(
+        with_latency(with_metrics(Either<int>{1}, metrics), latency),
+        CountingHook{{}, &ran, &skipped, &finished}
+      ),
+      budget
+    )
+    | incrementE
+    | stage("named", 1ms, incrementE)
+    | rejectE
+    | incrementE).result();
+  EXPECT_STREQ("Rejected", std::get<Err>(r).what());
+
+  EXPECT_EQ(3, ran);
+  EXPECT_EQ(1, skipped);
+  EXPECT_EQ(1, finished);
+
+  EXPECT_EQ(1u, metrics.stage_count(1, kMetricSucceeded));
+  EXPECT_EQ(1u, metrics.stage_count(2, kMetricFailed));
+  EXPECT_EQ(1u, metrics.stage_count(3, kMetricSkipped));
+  EXPECT_EQ(1u, metrics.pipeline_count(kMetricFailed));
+
+  auto stages = latency.snapshot();
+  ASSERT_EQ(3u, stages.size());
+  EXPECT_EQ(1u, stages[2].count);
+
+  auto const& records = budget.records();
+  ASSERT_EQ(4u, records.size());
+  EXPECT_STREQ("named", records[1].name);
+  EXPECT_EQ(StageOutcome::kRan, records[2].outcome);
+  EXPECT_EQ(StageOutcome::kShortCircuit, records[3].outcome);
+
+  auto m = (attach_hook(Maybe<int>{1}, CountingHook{{}, &ran, &skipped,
+    &finished}) | incrementM).result();
+  EXPECT_EQ(2, m.value());
+  EXPECT_EQ(4, ran);
+}
+
+// ----------------------------------------------------------------------------
+// Outer Hook First
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that a hook attached first keeps the hooks attached
+//              after it from seeing the stages it stops.
+//
+// ----------------------------------------------------------------------------
+TEST(StageHooksTest, OuterHookFirst) {
+  int ran = 0;
+  int skipped = 0;
+  int finished = 0;
+  auto& metrics = MetricsRegistry::instance().pipeline("cancelled hooks");
+  CancellationSource source{};
+  auto token = source.token();
+
+  auto cancel = [&source](int a) {
+    source.cancel();
+    return Maybe<int>{a};
+  };
+
+  auto r = (with_metrics(
+      attach_hook(
+        with_cancellation(Maybe<int>{1}, token),
+        CountingHook{{}, &ran, &skipped, &finished}
+      ),
+      metrics
+    )
+    | incrementM
+    | cancel
+    | incrementM).result();
+  EXPECT_FALSE(r);
+
+  EXPECT_EQ(2, ran);
+  EXPECT_EQ(0, skipped);
+  EXPECT_EQ(1, finished);
+
+  EXPECT_EQ(1u, metrics.stage_count(1, kMetricSucceeded));
+  EXPECT_EQ(0u, metrics.stage_count(2, kMetricSucceeded));
+  EXPECT_EQ(0u, metrics.stage_count(2, kMetricFailed));
+  EXPECT_EQ(1u, metrics.pipeline_count(kMetricFailed));
+}
+
+// ----------------------------------------------------------------------------
+// Traced Budget
+// ----------------------------------------------------------------------------
+//
+// Description: Tests that budgeted stages are traced under the name of the
+//              callable they wrap and that a skipped stage is not traced.
+//
+// ----------------------------------------------------------------------------
+TEST(StageHooksTest, TracedBudget) {
+  auto& tracer = Tracer::instance();
+  tracer.enable();
+
+  TimeBudget budget{0s};
+  auto r = (with_tracing(with_budget(Maybe<int>{1}, budget), "budgeted")
+    | stage("required", 1ms, labeled("increment", incrementM))
+    | optional_stage("optional", 1ms, labeled("skipped", incrementM))).result();
+  EXPECT_FALSE(r);
+  tracer.enable(false);
+
+  std::ostringstream out{};
+  tracer.write_json(out);
+  auto json = out.str();
+  EXPECT_NE(std::string::npos, json.find("\"increment\""));
+  EXPECT_NE(std::string::npos, json.find("\"budgeted\""));
+  EXPECT_EQ(std::string::npos, json.find("\"skipped\""));
+}
+
+// End of 'TestStageHooks.cpp'